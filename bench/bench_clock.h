@@ -0,0 +1,15 @@
+#pragma once
+
+#include <time.h>
+
+/* Monotonic seconds. Benchmarks run without a window, so GetTime() is not available. */
+static inline double
+bench_now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
@@ -0,0 +1,145 @@
+/*
+ * Frame cost of the squares scene when most squares are asleep, and the cost
+ * of the coroutine schedule that each square owns.
+ *
+ * The scene is run twice with the same number of squares. In the baseline
+ * every square starts the normal sequence on the first frame. That sequence
+ * has sleeps of its own (0.6s of about 2.2s), so some baseline squares are
+ * parked at any moment. In the second run 90% of the squares sleep through
+ * a long start delay and the other 10% run the same sequence as the
+ * baseline. Parked squares are not resumed, so the second run should cost
+ * about a tenth of the baseline.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include "bench_clock.h"
+
+#include "animation1.h"
+#include "environment.h"
+
+#include <coroutine.h>
+
+#include <raylib.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+
+static size_t const square_count = 10000;
+static size_t const frame_count = 120;
+
+/* Longer than the run, so sleeping squares never wake. */
+static float const long_sleep = 3600.f;
+
+/* Peak resident set size in KiB, as Linux reports it. */
+static long
+peak_rss_kib(void)
+{
+    struct rusage usage;
+
+    getrusage(RUSAGE_SELF, &usage);
+
+    return usage.ru_maxrss;
+}
+
+/*
+ * Open and close one schedule per square. This runs before the scenes, so
+ * that the growth in peak memory is down to the schedules alone.
+ */
+static void
+bench_schedules(void)
+{
+    struct schedule * * const schedules = calloc(square_count, sizeof(*schedules));
+    long const rss_before = peak_rss_kib();
+    double const start = bench_now();
+
+    for (size_t i = 0; i < square_count; i++)
+    {
+        schedules[i] = coroutine_open();
+    }
+
+    double const opened = bench_now();
+    long const rss_after = peak_rss_kib();
+
+    for (size_t i = 0; i < square_count; i++)
+    {
+        coroutine_close(schedules[i]);
+    }
+
+    double const closed = bench_now();
+
+    printf(
+        "%zu schedules: open %.1f us, close %.1f us in total, peak RSS grew %ld KiB\n",
+        square_count,
+        (opened - start) * 1e6,
+        (closed - opened) * 1e6,
+        rss_after - rss_before
+    );
+
+    free(schedules);
+}
+
+static double
+run_scene(size_t const sleeping_percent)
+{
+    animation_handlers_st const * const handlers = get_animation1_animation_handlers();
+    void * const ctx = animation1_init();
+
+    for (size_t i = 0; i < square_count; i++)
+    {
+        square_spawn_params_st const params = {
+            .pos_x = (float)(i % 100) * 8.f,
+            .pos_y = (float)(i / 100) * 6.f,
+            .max_size = 6.f,
+            .color = RED,
+            .start_delay = i % 100 < sleeping_percent ? long_sleep : 0.f,
+        };
+
+        animation1_spawn(ctx, &params);
+    }
+
+    Environment const env = {
+        .delta = {1.f / 60.f},
+        .screen = {.width = 800.f, .height = 600.f},
+        .quality = {.low_priority_update_interval = 1, .draw_fraction = 1.f},
+    };
+
+    /* The first frame starts every square, including the ones that go to sleep. */
+    handlers->update(ctx, &env);
+
+    double const start = bench_now();
+
+    for (size_t frame = 0; frame < frame_count; frame++)
+    {
+        handlers->update(ctx, &env);
+    }
+
+    double const elapsed = bench_now() - start;
+
+    handlers->free(ctx);
+
+    return elapsed * 1e3 / frame_count;
+}
+
+int
+main(void)
+{
+    bench_schedules();
+
+    double const baseline = run_scene(0);
+    double const mostly_asleep = run_scene(90);
+
+    printf(
+        "%zu squares, %zu frames\n"
+        "all running the sequence:        %.3f ms per frame\n"
+        "90%% asleep through a start delay: %.3f ms per frame (%.0f%% of the baseline)\n",
+        square_count,
+        frame_count,
+        baseline,
+        mostly_asleep,
+        mostly_asleep * 100. / baseline
+    );
+
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,134 @@
+/*
+ * Spawn/despawn churn throughput.
+ *
+ * Measures the slot pool on its own, then a squares scene that holds a fixed
+ * population while spawning and despawning a batch of squares every frame.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include "bench_clock.h"
+
+#include "animation1.h"
+#include "environment.h"
+#include "slot_pool.h"
+
+#include <raylib.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static size_t const pool_live = 1000;
+static size_t const pool_cycles = 10000000;
+
+static size_t const scene_population = 2000;
+static size_t const scene_churn_per_frame = 200;
+static size_t const scene_frames = 300;
+
+static void
+bench_slot_pool(void)
+{
+    slot_pool_st pool = {0};
+    slot_handle_st * const live = calloc(pool_live, sizeof(*live));
+
+    for (size_t i = 0; i < pool_live; i++)
+    {
+        live[i] = slot_pool_acquire(&pool);
+    }
+
+    double const start = bench_now();
+
+    /* Release the oldest handle and acquire a replacement, round robin. */
+    for (size_t i = 0; i < pool_cycles; i++)
+    {
+        size_t const victim = i % pool_live;
+
+        slot_pool_release(&pool, live[victim]);
+        live[victim] = slot_pool_acquire(&pool);
+    }
+
+    double const elapsed = bench_now() - start;
+
+    printf(
+        "slot pool: %zu release/acquire pairs in %.3f s (%.1f ns per pair), %zu slots\n",
+        pool_cycles,
+        elapsed,
+        elapsed * 1e9 / pool_cycles,
+        pool.count
+    );
+
+    slot_pool_free(&pool);
+    free(live);
+}
+
+static void
+bench_scene(void)
+{
+    animation_handlers_st const * const handlers = get_animation1_animation_handlers();
+    void * const ctx = animation1_init();
+    slot_handle_st * const live = calloc(scene_population, sizeof(*live));
+    size_t oldest = 0;
+
+    for (size_t i = 0; i < scene_population; i++)
+    {
+        square_spawn_params_st const params = {
+            .pos_x = (float)(i % 40) * 20.f,
+            .pos_y = (float)(i / 40) * 20.f,
+            .max_size = 16.f,
+            .color = RED,
+        };
+
+        live[i] = animation1_spawn(ctx, &params);
+    }
+
+    Environment const env = {
+        .delta = {1.f / 60.f},
+        .screen = {.width = 800.f, .height = 600.f},
+        .quality = {.low_priority_update_interval = 1, .draw_fraction = 1.f},
+    };
+    size_t spawns = 0;
+    double const start = bench_now();
+
+    for (size_t frame = 0; frame < scene_frames; frame++)
+    {
+        for (size_t i = 0; i < scene_churn_per_frame; i++)
+        {
+            square_spawn_params_st const params = {
+                .pos_x = (float)(spawns % 40) * 20.f,
+                .pos_y = (float)(spawns / 40 % 30) * 20.f,
+                .max_size = 16.f,
+                .color = BLUE,
+            };
+
+            animation1_despawn(ctx, live[oldest]);
+            live[oldest] = animation1_spawn(ctx, &params);
+            oldest = (oldest + 1) % scene_population;
+            spawns++;
+        }
+        handlers->update(ctx, &env);
+    }
+
+    double const elapsed = bench_now() - start;
+
+    printf(
+        "squares scene: %zu frames, %zu spawns and despawns in %.3f s "
+        "(%.0f spawns per second, %.3f ms per frame)\n",
+        scene_frames,
+        spawns,
+        elapsed,
+        spawns / elapsed,
+        elapsed * 1e3 / scene_frames
+    );
+
+    handlers->free(ctx);
+    free(live);
+}
+
+int
+main(void)
+{
+    bench_slot_pool();
+    bench_scene();
+
+    return EXIT_SUCCESS;
+}
+
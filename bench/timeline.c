@@ -0,0 +1,120 @@
+/*
+ * Deep timeline composition throughput.
+ *
+ * Builds a timeline nested several levels deep out of staggered groups and
+ * repeats, alternating plain and yoyo repeats, then evaluates it for 10k
+ * objects with different start delays every frame.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include "bench_clock.h"
+
+#include "easing_functions.h"
+#include "timeline.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+enum
+{
+    PROPERTY_SCALE,
+    PROPERTY_ANGLE,
+    PROPERTY_ALPHA,
+    PROPERTY_COUNT,
+};
+
+static size_t const object_count = 10000;
+static size_t const frame_count = 300;
+static float const frame_time = 1.f / 60.f;
+static size_t const nesting_depth = 4;
+static size_t const children_per_level = 3;
+static size_t const repeats_per_level = 3;
+
+/* Stops the compiler discarding the work being measured. */
+static volatile float sink;
+
+/* Each level staggers copies of the level below and repeats the result. */
+static timeline_st *
+build_deep_timeline(size_t * const track_count)
+{
+    timeline_builder_st * const builder = timeline_builder_new();
+    timeline_node_st const spin_and_fade[] = {
+        timeline_tween(builder, PROPERTY_ANGLE, 0.f, 90.f, 0.2f, NULL),
+        timeline_tween(builder, PROPERTY_ALPHA, 1.f, 0.5f, 0.1f, ease_out_cubic),
+    };
+    timeline_node_st const steps[] = {
+        timeline_tween(builder, PROPERTY_SCALE, 0.f, 1.f, 0.1f, ease_out_cubic),
+        timeline_parallel(builder, spin_and_fade, 2),
+    };
+    timeline_node_st node = timeline_sequence(builder, steps, 2);
+    size_t tracks = 3;
+
+    for (size_t level = 0; level < nesting_depth; level++)
+    {
+        timeline_node_st children[children_per_level];
+
+        for (size_t i = 0; i < children_per_level; i++)
+        {
+            children[i] = node;
+        }
+
+        timeline_node_st const stagger =
+            timeline_stagger(builder, children, children_per_level, 0.05f);
+
+        node = timeline_repeat(builder, stagger, repeats_per_level, level % 2 == 0);
+        tracks *= children_per_level * repeats_per_level;
+    }
+
+    timeline_st * const timeline = timeline_compile(builder, node);
+
+    timeline_builder_free(builder);
+    *track_count = tracks;
+
+    return timeline;
+}
+
+int
+main(void)
+{
+    size_t track_count;
+    timeline_st * const timeline = build_deep_timeline(&track_count);
+    float const duration = timeline_duration(timeline);
+    float values[PROPERTY_COUNT] = {0};
+    double const start = bench_now();
+
+    for (size_t frame = 0; frame < frame_count; frame++)
+    {
+        float const now = frame * frame_time;
+        float total = 0.f;
+
+        for (size_t i = 0; i < object_count; i++)
+        {
+            /* Spread the objects across the whole timeline. */
+            float const delay = duration * i / object_count;
+
+            timeline_evaluate(timeline, now - delay, values);
+            total += values[PROPERTY_SCALE] + values[PROPERTY_ANGLE] + values[PROPERTY_ALPHA];
+        }
+        sink = total;
+    }
+
+    double const elapsed = bench_now() - start;
+    size_t const evaluations = object_count * frame_count;
+
+    printf(
+        "%zu levels deep, %zu tracks, %.1f s long\n"
+        "%zu objects, %zu frames: %.3f ms per frame (%.1f ns per object)\n",
+        nesting_depth,
+        track_count,
+        duration,
+        object_count,
+        frame_count,
+        elapsed * 1e3 / frame_count,
+        elapsed * 1e9 / evaluations
+    );
+
+    timeline_free(timeline);
+
+    return EXIT_SUCCESS;
+}
+
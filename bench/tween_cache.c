@@ -0,0 +1,120 @@
+/*
+ * Synchronized tween throughput.
+ *
+ * 100k objects run tweens that start in groups, as squares spawned or woken
+ * in the same frame do. Each frame samples every tween, first by evaluating
+ * the easing function directly and then through the tween cache.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include "bench_clock.h"
+
+#include "easing_functions.h"
+#include "tween_cache.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static size_t const object_count = 100000;
+static size_t const group_count = 100;
+static size_t const frame_count = 120;
+static float const frame_time = 1.f / 60.f;
+static float const tween_duration = 1.f;
+
+/* Stops the compiler discarding the work being measured. */
+static volatile float sink;
+
+static double
+group_start(size_t const object)
+{
+    size_t const group = object % group_count;
+
+    return group * frame_time * 0.5;
+}
+
+static double
+bench_direct(void)
+{
+    double const start = bench_now();
+    double now = 0.;
+
+    for (size_t frame = 0; frame < frame_count; frame++)
+    {
+        float total = 0.f;
+
+        now += frame_time;
+        for (size_t i = 0; i < object_count; i++)
+        {
+            float fraction = (float)((now - group_start(i)) / tween_duration);
+
+            fraction = fraction < 0.f ? 0.f : fraction > 1.f ? 1.f : fraction;
+            total += ease_out_cubic(fraction);
+        }
+        sink = total;
+    }
+
+    return bench_now() - start;
+}
+
+static double
+bench_cached(tween_cache_stats_st * const stats)
+{
+    tween_cache_st * const cache = tween_cache_new();
+    tween_st * const tweens = calloc(object_count, sizeof(*tweens));
+
+    for (size_t i = 0; i < object_count; i++)
+    {
+        tweens[i] = tween_cache_tween(ease_out_cubic, group_start(i), tween_duration);
+    }
+
+    double const start = bench_now();
+    double now = 0.;
+
+    for (size_t frame = 0; frame < frame_count; frame++)
+    {
+        float total = 0.f;
+
+        now += frame_time;
+        tween_cache_begin_frame(cache, now);
+        for (size_t i = 0; i < object_count; i++)
+        {
+            total += tween_cache_sample(cache, &tweens[i]).eased;
+        }
+        sink = total;
+    }
+
+    double const elapsed = bench_now() - start;
+
+    *stats = tween_cache_stats(cache);
+    free(tweens);
+    tween_cache_free(cache);
+
+    return elapsed;
+}
+
+int
+main(void)
+{
+    size_t const samples = object_count * frame_count;
+    double const direct = bench_direct();
+    tween_cache_stats_st stats;
+    double const cached = bench_cached(&stats);
+
+    printf(
+        "%zu objects in %zu groups, %zu frames\n"
+        "direct: %.3f ms per frame (%.1f ns per sample), %zu easing evaluations\n"
+        "cached: %.3f ms per frame (%.1f ns per sample), %zu easing evaluations\n",
+        object_count,
+        group_count,
+        frame_count,
+        direct * 1e3 / frame_count,
+        direct * 1e9 / samples,
+        samples,
+        cached * 1e3 / frame_count,
+        cached * 1e9 / samples,
+        stats.evaluations
+    );
+
+    return EXIT_SUCCESS;
+}
+
@@ -2,7 +2,11 @@
 
 #include "dynamic_array.h"
 #include "easing_functions.h"
+#include "flow_layout.h"
+#include "renderer.h"
+#include "slot_pool.h"
 #include "utils.h"
+#include "wake_queue.h"
 
 #include <coroutine.h>
 
@@ -10,30 +14,42 @@
 #include <raymath.h>
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 
 typedef struct
 {
     float value;
-} Fraction;
+} TotalTime;
 
 typedef struct
 {
-    float value;
-} TotalTime;
+    /* Module clock time at which the tween started. */
+    double start;
+    float duration;
+} square_tween_st;
 
 
 typedef struct AnimationContext AnimationContext;
 typedef struct square_animation_st square_animation_st;
 
-typedef void (*square_draw_fn)(square_animation_st * const ani);
+typedef void (*square_draw_fn)(square_animation_st * const ani, renderer_st const * renderer);
 
 struct square_animation_st
 {
     struct AnimationContext * ctx;
     square_draw_fn draw;
+    /* Each square has its own schedule so that it can be resumed on its own. */
+    struct schedule * schedule;
     coroutine_t * co;
+    slot_handle_st handle;
+    size_t live_index;
+    bool despawn_pending;
+    bool despawn_when_done;
+    /* Sleeping in the wake queue rather than in the runnable list. */
+    bool parked;
+    float start_delay;
     float max_size;
     float current_size;
     float current_angle;
@@ -48,23 +64,48 @@ typedef struct square_animations_st {
     size_t capacity;
 } square_animations_st;
 
+typedef struct slot_handles_st {
+    slot_handle_st * items;
+    size_t count;
+    size_t capacity;
+} slot_handles_st;
+
 struct AnimationContext
 {
-    struct schedule * schedule;
     float sleep;
     Environment const * env;
+    /*
+     * Seconds of animation time at the end of the current frame. A double, as
+     * it accumulates for as long as the scene runs.
+     */
+    double time;
+    /* Live animations, densely packed for iteration. */
     square_animations_st animations;
+    /* Indexed by slot. Entries are kept after despawn and reused by the next spawn. */
+    square_animations_st slots;
+    slot_pool_st slot_pool;
+    slot_handles_st pending_despawns;
+    /* Squares to resume this frame. Sleeping squares are parked in 'sleepers'. */
+    slot_handles_st runnable;
+    slot_handles_st still_runnable;
+    wake_queue_st sleepers;
+    flow_layout_st * layout;
+    /* The square placed by each layout item. */
+    slot_handles_st layout_squares;
+    /* Number of squares to draw, lowered when the frame governor degrades quality. */
+    size_t draw_count;
 };
 
 static size_t const stack_size = 10000;
 
 static void
-draw_square_animation(square_animation_st * const ani)
+draw_square_animation(square_animation_st * const ani, renderer_st const * const renderer)
 {
     float const square_size = ani->current_size;
     float const origin_offset = square_size / 2.f;
 
-    DrawRectanglePro(
+    renderer->handlers->rectangle_pro(
+        renderer->ctx,
         (Rectangle){ ani->pos_x, ani->pos_y, square_size, square_size },
         (Vector2) { origin_offset, origin_offset },
         ani->current_angle,
@@ -76,12 +117,26 @@ static void
 animation1_free(void * const pv)
 {
     AnimationContext * const ctx = pv;
-    square_animations_st * const animations = &ctx->animations;
 
-    for (size_t i = 0; i < animations->count; i++)
+    for (size_t i = 0; i < ctx->slots.count; i++)
     {
-        free(animations->items[i]);
+        square_animation_st * const ani = ctx->slots.items[i];
+
+        if (ani != NULL)
+        {
+            coroutine_close(ani->schedule);
+            free(ani);
+        }
     }
+    da_free(ctx->animations);
+    da_free(ctx->slots);
+    da_free(ctx->pending_despawns);
+    da_free(ctx->runnable);
+    da_free(ctx->still_runnable);
+    wake_queue_free(&ctx->sleepers);
+    da_free(ctx->layout_squares);
+    flow_layout_free(ctx->layout);
+    slot_pool_free(&ctx->slot_pool);
     free(ctx);
 }
 
@@ -92,18 +147,33 @@ animation1_reset_state(square_animation_st * const ani)
     ani->current_angle = 0.f;
 }
 
-static Fraction
-update_fraction_complete(
-    Fraction const current_fraction,
-    DeltaTime const delta_time,
-    TotalTime const total_time
-)
+/* A tween starts at the beginning of the frame in which it is first run. */
+static square_tween_st
+begin_tween(AnimationContext const * const ctx, TotalTime const total_time)
 {
-    Fraction fraction = {.value = current_fraction.value + delta_time.value / total_time.value};
+    double const frame_start = ctx->time - ctx->env->delta.value;
+
+    return (square_tween_st){.start = frame_start, .duration = total_time.value};
+}
 
-    if (fraction.value > 1.f)
+/* Fraction of the tween completed by the end of the current frame. */
+static float
+tween_fraction(AnimationContext const * const ctx, square_tween_st const * const tween)
+{
+    if (tween->duration <= 0.f)
     {
-        fraction.value = 1.f;
+        return 1.f;
+    }
+
+    float const fraction = (float)((ctx->time - tween->start) / tween->duration);
+
+    if (fraction > 1.f)
+    {
+        return 1.f;
+    }
+    if (fraction < 0.f)
+    {
+        return 0.f;
     }
 
     return fraction;
@@ -112,28 +182,30 @@ update_fraction_complete(
 static void expand_square(square_animation_st * const ani, TotalTime const resize_time)
 {
     AnimationContext * const ctx = ani->ctx;
-    Fraction fraction = {.value = .0f};
+    square_tween_st const tween = begin_tween(ctx, resize_time);
+    float fraction = .0f;
 
-    while (fraction.value < 1.f)
+    while (fraction < 1.f)
     {
-        fraction = update_fraction_complete(fraction, ctx->env->delta, resize_time);
+        fraction = tween_fraction(ctx, &tween);
 
-        ani->current_size = Lerp(0.f, ani->max_size, ease_out_cubic(fraction.value));
-        coroutine_yield(ctx->schedule);
+        ani->current_size = Lerp(0.f, ani->max_size, ease_out_cubic(fraction));
+        coroutine_yield(ani->schedule);
     }
 }
 
 static void shrink_square(square_animation_st * const ani, TotalTime const resize_time)
 {
     AnimationContext * const ctx = ani->ctx;
-    Fraction fraction = {.value = .0f};
+    square_tween_st const tween = begin_tween(ctx, resize_time);
+    float fraction = .0f;
 
-    while (fraction.value < 1.f)
+    while (fraction < 1.f)
     {
-        fraction = update_fraction_complete(fraction, ctx->env->delta, resize_time);
+        fraction = tween_fraction(ctx, &tween);
 
-        ani->current_size = Lerp(ani->max_size, 0.f, ease_out_cubic(fraction.value));
-        coroutine_yield(ctx->schedule);
+        ani->current_size = Lerp(ani->max_size, 0.f, ease_out_cubic(fraction));
+        coroutine_yield(ani->schedule);
     }
 }
 
@@ -142,28 +214,31 @@ rotate_square(square_animation_st * const ani, float const angle_degrees, TotalT
 {
     AnimationContext * const ctx = ani->ctx;
     float start_angle = ani->current_angle;
-    Fraction fraction = {.value = .0f};
+    square_tween_st const tween = begin_tween(ctx, rotate_time);
+    float fraction = .0f;
 
-    while (fraction.value < 1.f)
+    while (fraction < 1.f)
     {
-        fraction = update_fraction_complete(fraction, ctx->env->delta, rotate_time);
+        fraction = tween_fraction(ctx, &tween);
 
-        ani->current_angle = start_angle + Lerp(0.f, angle_degrees, ease_out_cubic(fraction.value));
-        coroutine_yield(ctx->schedule);
+        ani->current_angle = start_angle + Lerp(0.f, angle_degrees, ease_out_cubic(fraction));
+        coroutine_yield(ani->schedule);
     }
 }
 
+/*
+ * Park the square until the sleep has elapsed. It is not resumed at all in
+ * the meantime, and wakes on the frame after the one in which the sleep
+ * time runs out, as a tween would finish.
+ */
 static void animation_sleep(square_animation_st * const ani, TotalTime const sleep_time)
 {
     AnimationContext * const ctx = ani->ctx;
-    Fraction fraction = {.value = .0f};
-
-    while (fraction.value < 1.f)
-    {
-        fraction = update_fraction_complete(fraction, ctx->env->delta, sleep_time);
+    double const frame_start = ctx->time - ctx->env->delta.value;
 
-        coroutine_yield(ctx->schedule);
-    }
+    ani->parked = true;
+    wake_queue_push(&ctx->sleepers, frame_start + sleep_time.value, ani->handle);
+    coroutine_yield(ani->schedule);
 }
 
 static void
@@ -174,9 +249,13 @@ animation_coroutine(struct schedule * const s, void * const arg)
 
     animation1_reset_state(ani);
 
-    AnimationContext const * const ctx = ani->ctx;
+    AnimationContext * const ctx = ani->ctx;
     TotalTime const sleep = {ctx->sleep};
 
+    if (ani->start_delay > 0.f)
+    {
+        animation_sleep(ani, (TotalTime){ani->start_delay});
+    }
     expand_square(ani, sleep);
     animation_sleep(ani, sleep);
     rotate_square(ani, 720.f + 45.f, (TotalTime){sleep.value * 5});
@@ -184,6 +263,11 @@ animation_coroutine(struct schedule * const s, void * const arg)
     rotate_square(ani, -45.f, sleep);
     animation_sleep(ani, sleep);
     shrink_square(ani, sleep);
+
+    if (ani->despawn_when_done)
+    {
+        animation1_despawn(ctx, ani->handle);
+    }
 }
 
 static void
@@ -194,15 +278,83 @@ animation_cleanup(void * const arg)
     UNUSED_PARAM(ani);
 }
 
+static square_animation_st *
+live_animation(AnimationContext const * const ctx, slot_handle_st const handle)
+{
+    if (!slot_pool_is_live(&ctx->slot_pool, handle))
+    {
+        return NULL;
+    }
+
+    return ctx->slots.items[handle.index];
+}
+
+static void
+wake_sleepers(AnimationContext * const ctx)
+{
+    double const frame_start = ctx->time - ctx->env->delta.value;
+    slot_handle_st handle;
+
+    while (wake_queue_pop_due(&ctx->sleepers, frame_start, &handle))
+    {
+        square_animation_st * const ani = live_animation(ctx, handle);
+
+        /* Squares despawned while asleep leave stale entries behind. */
+        if (ani != NULL && ani->parked)
+        {
+            ani->parked = false;
+            da_append(&ctx->runnable, handle);
+        }
+    }
+}
+
 static void
 update_animations(void * const pv)
 {
     AnimationContext * const ctx = pv;
 
-    if (coroutine_active_count(ctx->schedule) > 0)
+    wake_sleepers(ctx);
+
+    ctx->still_runnable.count = 0;
+    /* Indexed rather than iterated by pointer, as a resumed square may spawn another. */
+    for (size_t i = 0; i < ctx->runnable.count; i++)
+    {
+        slot_handle_st const handle = ctx->runnable.items[i];
+        square_animation_st * const ani = live_animation(ctx, handle);
+
+        if (ani == NULL || coroutine_active_count(ani->schedule) == 0)
+        {
+            continue;
+        }
+        coroutine_resume(ani->schedule, coroutine_resume_all);
+
+        if (!ani->parked && coroutine_active_count(ani->schedule) > 0)
+        {
+            da_append(&ctx->still_runnable, handle);
+        }
+    }
+
+    slot_handles_st const finished = ctx->runnable;
+
+    ctx->runnable = ctx->still_runnable;
+    ctx->still_runnable = finished;
+}
+
+static void
+start_animation(square_animation_st * const ani)
+{
+    if (ani->co != NULL)
     {
-        coroutine_resume(ctx->schedule, coroutine_resume_all);
+        coroutine_kill(ani->co);
     }
+    coroutine_handlers_t const handlers = {
+        .run = animation_coroutine,
+        .cleanup = animation_cleanup,
+    };
+    ani->co = coroutine_new(ani->schedule, &handlers, ani, stack_size);
+    ani->parked = false;
+
+    animation1_reset_state(ani);
 }
 
 static void
@@ -210,21 +362,140 @@ animation1_reset(void * const pv)
 {
     AnimationContext * const ctx = pv;
 
+    /* Every square restarts, so any sleeps in progress are abandoned. */
+    wake_queue_clear(&ctx->sleepers);
+    ctx->runnable.count = 0;
+
     for (size_t i = 0; i < ctx->animations.count; i++)
     {
         square_animation_st * const ani = ctx->animations.items[i];
 
-        if (ani->co != NULL)
+        start_animation(ani);
+        da_append(&ctx->runnable, ani->handle);
+    }
+}
+
+static square_animation_st *
+slot_animation(AnimationContext * const ctx, uint32_t const index)
+{
+    while (index >= ctx->slots.count)
+    {
+        da_append(&ctx->slots, NULL);
+    }
+    if (ctx->slots.items[index] == NULL)
+    {
+        square_animation_st * const ani = calloc(1, sizeof(*ani));
+        assert(ani != NULL);
+
+        ani->schedule = coroutine_open();
+        assert(ani->schedule != NULL);
+        ctx->slots.items[index] = ani;
+    }
+
+    return ctx->slots.items[index];
+}
+
+slot_handle_st
+animation1_spawn(void * const pv, square_spawn_params_st const * const params)
+{
+    AnimationContext * const ctx = pv;
+    slot_handle_st const handle = slot_pool_acquire(&ctx->slot_pool);
+    square_animation_st * const ani = slot_animation(ctx, handle.index);
+
+    *ani = (square_animation_st){
+        .ctx = ctx,
+        .draw = draw_square_animation,
+        .schedule = ani->schedule,
+        .handle = handle,
+        .live_index = ctx->animations.count,
+        .despawn_when_done = params->despawn_when_done,
+        .start_delay = params->start_delay,
+        .max_size = params->max_size,
+        .pos_x = params->pos_x,
+        .pos_y = params->pos_y,
+        .color = params->color,
+    };
+    da_append(&ctx->animations, ani);
+
+    start_animation(ani);
+    da_append(&ctx->runnable, handle);
+
+    return handle;
+}
+
+bool
+animation1_despawn(void * const pv, slot_handle_st const handle)
+{
+    AnimationContext * const ctx = pv;
+
+    if (!slot_pool_is_live(&ctx->slot_pool, handle))
+    {
+        return false;
+    }
+
+    square_animation_st * const ani = ctx->slots.items[handle.index];
+
+    /* Destruction is deferred to the end of the frame. */
+    if (!ani->despawn_pending)
+    {
+        ani->despawn_pending = true;
+        da_append(&ctx->pending_despawns, handle);
+    }
+
+    return true;
+}
+
+static void
+destroy_animation(AnimationContext * const ctx, square_animation_st * const ani)
+{
+    square_animations_st * const animations = &ctx->animations;
+    size_t const live_index = ani->live_index;
+
+    coroutine_kill(ani->co);
+    ani->co = NULL;
+
+    da_remove_unordered(animations, live_index);
+    if (live_index < animations->count)
+    {
+        animations->items[live_index]->live_index = live_index;
+    }
+
+    slot_pool_release(&ctx->slot_pool, ani->handle);
+}
+
+static void
+process_pending_despawns(AnimationContext * const ctx)
+{
+    for (size_t i = 0; i < ctx->pending_despawns.count; i++)
+    {
+        slot_handle_st const handle = ctx->pending_despawns.items[i];
+
+        if (slot_pool_is_live(&ctx->slot_pool, handle))
         {
-            coroutine_kill(ani->co);
+            destroy_animation(ctx, ctx->slots.items[handle.index]);
         }
-        coroutine_handlers_t const handlers = {
-            .run = animation_coroutine,
-            .cleanup = animation_cleanup,
-        };
-        ani->co = coroutine_new(ani->ctx->schedule, &handlers, ani, stack_size);
+    }
+    ctx->pending_despawns.count = 0;
+}
+
+/* Move the squares that follow the layout, starting from item 'first'. */
+static void
+apply_layout(AnimationContext * const ctx, size_t const first)
+{
+    for (size_t i = first; i < ctx->layout_squares.count; i++)
+    {
+        slot_handle_st const handle = ctx->layout_squares.items[i];
+
+        if (!slot_pool_is_live(&ctx->slot_pool, handle))
+        {
+            continue;
+        }
+
+        square_animation_st * const ani = ctx->slots.items[handle.index];
+        Rectangle const rect = flow_layout_item_rect(ctx->layout, i);
 
-        animation1_reset_state(ani);
+        ani->pos_x = rect.x + rect.width / 2.f;
+        ani->pos_y = rect.y + rect.height / 2.f;
     }
 }
 
@@ -250,55 +521,44 @@ animation1_init(void)
     AnimationContext * ctx = calloc(1, sizeof(*ctx));
     assert(ctx != NULL);
 
-    ctx->schedule = coroutine_open();
-    assert(ctx->schedule != NULL);
-
     ctx->sleep = 0.2f;
 
-    float const row_height = 200.f;
-    float const pad = 10.f;
-    float row_y = pad;
-
-    for (size_t i = 0, j=0; i < 15; i++, j++)
-    {
-        square_animation_st * const ani = calloc(1, sizeof(*ani));
-
-        assert(ani != NULL);
+    flow_layout_config_st const layout_config = {
+        .pad = 10.f,
+        .min_row_height = 200.f,
+    };
 
-        ani->max_size = 40.f + (i * i);
+    ctx->layout = flow_layout_new(&layout_config, GetScreenWidth());
 
-        float const step = ani->max_size + 10.f;
-        float pos_x = (ani->max_size/ 2.f) + 10 + (j * step);
+    for (size_t i = 0; i < 15; i++)
+    {
+        float const max_size = 40.f + (i * i);
 
-        if (pos_x + ani->max_size >= GetScreenWidth())
-        {
-            row_y += row_height + pad;
-            j = 0;
-            pos_x = (ani->max_size/ 2.f) + 10 + (j * step);
-        }
+        flow_layout_add_item(ctx->layout, (Vector2){max_size, max_size});
 
-        ani->pos_x = (ani->max_size/ 2.f) + 10 + (j * step);
-        ani->pos_y = (ani->max_size/ 2.f) + row_y;
-        ani->ctx = ctx;
-        ani->draw = draw_square_animation;
-        ani->color = colors[(i % ARRAY_SIZE(colors))];
+        square_spawn_params_st const params = {
+            .max_size = max_size,
+            .color = colors[(i % ARRAY_SIZE(colors))],
+        };
 
-        da_append(&ctx->animations, ani);
+        da_append(&ctx->layout_squares, animation1_spawn(ctx, &params));
     }
 
-    animation1_reset(ctx);
+    flow_layout_update(ctx->layout);
+    apply_layout(ctx, 0);
+    ctx->draw_count = ctx->animations.count;
 
     return ctx;
 }
 
 static void
-draw_animations(AnimationContext const * const ctx)
+draw_animations(AnimationContext const * const ctx, renderer_st const * const renderer)
 {
-    for (size_t i = 0; i < ctx->animations.count; i++)
+    for (size_t i = 0; i < ctx->draw_count && i < ctx->animations.count; i++)
     {
         square_animation_st * const ani = ctx->animations.items[i];
 
-        ani->draw(ani);
+        ani->draw(ani, renderer);
     }
 }
 
@@ -308,15 +568,24 @@ animation1_update(void * const pv, Environment const * const env)
     AnimationContext * const ctx = pv;
     assert(ctx != NULL);
     ctx->env = env;
+    ctx->time += env->delta.value;
 
+    if (env->resized)
+    {
+        flow_layout_set_width(ctx->layout, env->screen.width);
+        apply_layout(ctx, flow_layout_update(ctx->layout));
+    }
     update_animations(ctx);
+    process_pending_despawns(ctx);
+
+    ctx->draw_count = ctx->animations.count * env->quality.draw_fraction;
 }
 
 static void
-animation1_draw(void const * const pv)
+animation1_draw(void const * const pv, renderer_st const * const renderer)
 {
     AnimationContext const * const ctx = pv;
-    draw_animations(ctx);
+    draw_animations(ctx, renderer);
 }
 
 static animation_handlers_st const
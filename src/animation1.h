@@ -3,7 +3,23 @@
 #include "animation_modules.h"
 
 #include "environment.h"
+#include "slot_pool.h"
 
+#include <raylib.h>
+
+#include <stdbool.h>
+
+
+typedef struct
+{
+    float pos_x;
+    float pos_y;
+    float max_size;
+    Color color;
+    /* Seconds to wait before the animation sequence starts. */
+    float start_delay;
+    bool despawn_when_done;
+} square_spawn_params_st;
 
 void *
 animation1_init(void);
@@ -11,3 +27,15 @@ animation1_init(void);
 animation_handlers_st const *
 get_animation1_animation_handlers(void);
 
+/* Add a square to a running scene. Slots are recycled in O(1). */
+slot_handle_st
+animation1_spawn(void * ctx, square_spawn_params_st const * params);
+
+/*
+ * Remove a square. The square is destroyed at the end of the current update,
+ * so this is safe to call from within an animation. Returns false if the
+ * handle is stale.
+ */
+bool
+animation1_despawn(void * ctx, slot_handle_st handle);
+
@@ -0,0 +1,200 @@
+#include "animation2.h"
+
+#include "dynamic_array.h"
+#include "easing_functions.h"
+#include "renderer.h"
+#include "timeline.h"
+#include "utils.h"
+
+#include <raylib.h>
+
+#include <assert.h>
+#include <stdlib.h>
+
+typedef enum
+{
+    SQUARE_PROPERTY_SCALE,
+    SQUARE_PROPERTY_ANGLE,
+    SQUARE_PROPERTY_COUNT,
+} square_property;
+
+typedef struct
+{
+    float values[SQUARE_PROPERTY_COUNT];
+    float start_delay;
+    float max_size;
+    float pos_x;
+    float pos_y;
+    Color color;
+} timeline_square_st;
+
+typedef struct timeline_squares_st {
+    timeline_square_st * items;
+    size_t count;
+    size_t capacity;
+} timeline_squares_st;
+
+typedef struct AnimationContext AnimationContext;
+struct AnimationContext
+{
+    timeline_st * timeline;
+    float time;
+    timeline_squares_st squares;
+    /* Number of squares to draw, lowered when the frame governor degrades quality. */
+    size_t draw_count;
+};
+
+static size_t const grid_columns = 20;
+static size_t const grid_rows = 14;
+static float const cell_size = 36.f;
+static float const stagger_step = 0.04f;
+
+/*
+ * Grow, then spin while shrinking, and play the whole thing back in reverse.
+ * Every square shares this timeline and only differs in its start delay.
+ */
+static timeline_st *
+build_square_timeline(void)
+{
+    timeline_builder_st * const builder = timeline_builder_new();
+    timeline_node_st const grow =
+        timeline_tween(builder, SQUARE_PROPERTY_SCALE, 0.f, 1.f, 0.4f, ease_out_cubic);
+    timeline_node_st const shrink_steps[] = {
+        timeline_delay(builder, 0.3f),
+        timeline_tween(builder, SQUARE_PROPERTY_SCALE, 1.f, 0.2f, 0.5f, ease_out_cubic),
+    };
+    timeline_node_st const spin_and_shrink[] = {
+        timeline_tween(builder, SQUARE_PROPERTY_ANGLE, 0.f, 180.f, 0.8f, NULL),
+        timeline_sequence(builder, shrink_steps, ARRAY_SIZE(shrink_steps)),
+    };
+    timeline_node_st const steps[] = {
+        grow,
+        timeline_parallel(builder, spin_and_shrink, ARRAY_SIZE(spin_and_shrink)),
+    };
+    timeline_node_st const root =
+        timeline_repeat(builder, timeline_sequence(builder, steps, ARRAY_SIZE(steps)), 2, true);
+    timeline_st * const timeline = timeline_compile(builder, root);
+
+    timeline_builder_free(builder);
+
+    return timeline;
+}
+
+static void
+draw_square(timeline_square_st const * const square, renderer_st const * const renderer)
+{
+    float const square_size = square->max_size * square->values[SQUARE_PROPERTY_SCALE];
+    float const origin_offset = square_size / 2.f;
+
+    renderer->handlers->rectangle_pro(
+        renderer->ctx,
+        (Rectangle){ square->pos_x, square->pos_y, square_size, square_size },
+        (Vector2) { origin_offset, origin_offset },
+        square->values[SQUARE_PROPERTY_ANGLE],
+        square->color
+    );
+}
+
+static void
+animation2_free(void * const pv)
+{
+    AnimationContext * const ctx = pv;
+
+    timeline_free(ctx->timeline);
+    da_free(ctx->squares);
+    free(ctx);
+}
+
+static void
+update_squares(AnimationContext * const ctx)
+{
+    da_foreach(timeline_square_st, square, &ctx->squares)
+    {
+        timeline_evaluate(ctx->timeline, ctx->time - square->start_delay, square->values);
+    }
+}
+
+static void
+animation2_reset(void * const pv)
+{
+    AnimationContext * const ctx = pv;
+
+    ctx->time = 0.f;
+    ctx->draw_count = ctx->squares.count;
+    update_squares(ctx);
+}
+
+void *
+animation2_init(void)
+{
+    static Color const colors[] =
+    {
+        SKYBLUE,
+        BLUE,
+        DARKBLUE,
+        PURPLE,
+        VIOLET,
+        DARKPURPLE,
+    };
+
+    AnimationContext * ctx = calloc(1, sizeof(*ctx));
+    assert(ctx != NULL);
+
+    ctx->timeline = build_square_timeline();
+
+    for (size_t row = 0; row < grid_rows; row++)
+    {
+        for (size_t column = 0; column < grid_columns; column++)
+        {
+            timeline_square_st const square = {
+                .start_delay = (row + column) * stagger_step,
+                .max_size = cell_size - 6.f,
+                .pos_x = (column + 0.5f) * cell_size + 40.f,
+                .pos_y = (row + 0.5f) * cell_size + 40.f,
+                .color = colors[(row + column) % ARRAY_SIZE(colors)],
+            };
+
+            da_append(&ctx->squares, square);
+        }
+    }
+
+    animation2_reset(ctx);
+
+    return ctx;
+}
+
+static void
+animation2_update(void * const pv, Environment const * const env)
+{
+    AnimationContext * const ctx = pv;
+    assert(ctx != NULL);
+
+    ctx->time += env->delta.value;
+    ctx->draw_count = ctx->squares.count * env->quality.draw_fraction;
+    update_squares(ctx);
+}
+
+static void
+animation2_draw(void const * const pv, renderer_st const * const renderer)
+{
+    AnimationContext const * const ctx = pv;
+
+    for (size_t i = 0; i < ctx->draw_count; i++)
+    {
+        draw_square(&ctx->squares.items[i], renderer);
+    }
+}
+
+static animation_handlers_st const
+animation2_handlers = {
+    .draw = animation2_draw,
+    .free = animation2_free,
+    .reset = animation2_reset,
+    .update = animation2_update,
+};
+
+animation_handlers_st const *
+get_animation2_animation_handlers(void)
+{
+    return &animation2_handlers;
+}
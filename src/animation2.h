@@ -0,0 +1,13 @@
+#pragma once
+
+#include "animation_modules.h"
+
+#include "environment.h"
+
+
+void *
+animation2_init(void);
+
+animation_handlers_st const *
+get_animation2_animation_handlers(void);
+
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "environment.h"
+#include "renderer.h"
 
 typedef void
 (*animation_reset_fn)(void * ctx);
@@ -12,7 +13,7 @@ typedef void
 (*animation_update_fn)(void * ctx, Environment const * env);
 
 typedef void
-(*animation_draw_fn)(void const * ctx);
+(*animation_draw_fn)(void const * ctx, renderer_st const * renderer);
 
 typedef struct animation_handlers_st {
     animation_reset_fn reset;
@@ -1,6 +1,7 @@
 #include "button1.h"
 
 #include "dynamic_array.h"
+#include "renderer.h"
 #include "utils.h"
 
 #include <coroutine.h>
@@ -21,6 +22,8 @@ typedef struct button_state_st {
 #define button_state_pressed (button_state_st){true}
 
 typedef struct button_config_st {
+    /* Position of the button centre as a fraction of the screen size. */
+    Vector2 anchor;
     Rectangle rec;
     Color pressed_color;
     Color unpressed_color;
@@ -40,11 +43,18 @@ struct ButtonContext
 };
 
 static void
-draw_button(button_st const * const b)
+draw_button(button_st const * const b, renderer_st const * const renderer)
 {
     Color color = b->state.is_pressed ? b->config.pressed_color : b->config.unpressed_color;
 
-    DrawRectangleRec(b->config.rec, color);
+    renderer->handlers->rectangle(renderer->ctx, b->config.rec, color);
+}
+
+static void
+place_button(button_st * const b, ScreenSize const screen)
+{
+    b->config.rec.x = screen.width * b->config.anchor.x - b->config.rec.width / 2.f;
+    b->config.rec.y = screen.height * b->config.anchor.y - b->config.rec.height / 2.f;
 }
 
 static void
@@ -95,18 +105,22 @@ button1_update(void * const pv, Environment const * const env)
     assert(ctx != NULL);
     ctx->env = env;
 
+    if (env->resized)
+    {
+        place_button(&ctx->button, env->screen);
+    }
     button_update(ctx);
 }
 
 static void
-button1_draw(void const * const pv)
+button1_draw(void const * const pv, renderer_st const * const renderer)
 {
     ButtonContext const * const ctx = pv;
-    draw_button(&ctx->button);
+    draw_button(&ctx->button, renderer);
 }
 
 void *
-button1_init(float const x, float const y, float const width, float const height)
+button1_init(float const anchor_x, float const anchor_y, float const width, float const height)
 {
     ButtonContext * ctx = calloc(1, sizeof(*ctx));
     assert(ctx != NULL);
@@ -115,7 +129,12 @@ button1_init(float const x, float const y, float const width, float const height
     ctx->button.config.pressed_color = RED;
     ctx->button.config.unpressed_color = GREEN;
 
-    ctx->button.config.rec = (Rectangle){.x = x, .y = y, .width = width, .height = height};
+    ctx->button.config.anchor = (Vector2){.x = anchor_x, .y = anchor_y};
+    ctx->button.config.rec = (Rectangle){.width = width, .height = height};
+
+    ScreenSize const screen = {.width = GetScreenWidth(), .height = GetScreenHeight()};
+
+    place_button(&ctx->button, screen);
 
     return ctx;
 }
@@ -5,8 +5,9 @@
 #include "environment.h"
 
 
+/* The anchor is the position of the button centre as a fraction of the screen size. */
 void *
-button1_init(float x, float y, float width, float height);
+button1_init(float anchor_x, float anchor_y, float width, float height);
 
 animation_handlers_st const *
 get_button_animation_handlers(void);
@@ -1,12 +1,35 @@
 #pragma once
 
+#include <stdbool.h>
+#include <stddef.h>
+
 typedef struct
 {
     float value;
 } DeltaTime;
 
+typedef struct
+{
+    float width;
+    float height;
+} ScreenSize;
+
+typedef struct
+{
+    /* 0 is full quality. Higher levels are cheaper. */
+    size_t level;
+    size_t low_priority_update_interval;
+    /* Fraction of their objects that modules should draw. */
+    float draw_fraction;
+    bool optional_effects;
+} FrameQuality;
+
 typedef struct
 {
     DeltaTime const delta;
+    ScreenSize const screen;
+    /* Set on the frame that a (coalesced) window resize is delivered. */
+    bool const resized;
+    FrameQuality const quality;
 } Environment;
 
@@ -0,0 +1,422 @@
+#include "flow_layout.h"
+
+#include "dynamic_array.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+typedef struct
+{
+    Vector2 * items;
+    size_t count;
+    size_t capacity;
+} item_sizes_st;
+
+typedef struct
+{
+    float * items;
+    size_t count;
+    size_t capacity;
+} floats_st;
+
+typedef struct
+{
+    size_t * items;
+    size_t count;
+    size_t capacity;
+} indexes_st;
+
+typedef struct
+{
+    floats_st * items;
+    size_t count;
+    size_t capacity;
+} sparse_levels_st;
+
+struct flow_layout_st
+{
+    flow_layout_config_st config;
+    float width;
+    item_sizes_st sizes;
+    /* advance[i] is the summed width plus padding of the items before 'i'. */
+    floats_st advance;
+    /* level[k][i] is the tallest item in [i, i + 2^k). */
+    sparse_levels_st tallest;
+    indexes_st row_starts;
+    floats_st row_y;
+    floats_st row_heights;
+    /* Row ends from before the current update, reused between updates. */
+    indexes_st previous_row_ends;
+    /* First item whose size changed since the last update. */
+    size_t dirty_from;
+    bool width_changed;
+};
+
+flow_layout_st *
+flow_layout_new(flow_layout_config_st const * const config, float const width)
+{
+    flow_layout_st * const layout = calloc(1, sizeof(*layout));
+    assert(layout != NULL);
+
+    layout->config = *config;
+    layout->width = width;
+    da_append(&layout->advance, 0.f);
+
+    return layout;
+}
+
+void
+flow_layout_free(flow_layout_st * const layout)
+{
+    if (layout == NULL)
+    {
+        return;
+    }
+    for (size_t k = 0; k < layout->tallest.count; k++)
+    {
+        da_free(layout->tallest.items[k]);
+    }
+    da_free(layout->tallest);
+    da_free(layout->sizes);
+    da_free(layout->advance);
+    da_free(layout->row_starts);
+    da_free(layout->row_y);
+    da_free(layout->row_heights);
+    da_free(layout->previous_row_ends);
+    free(layout);
+}
+
+static void
+mark_dirty(flow_layout_st * const layout, size_t const index)
+{
+    if (index < layout->dirty_from)
+    {
+        layout->dirty_from = index;
+    }
+}
+
+size_t
+flow_layout_add_item(flow_layout_st * const layout, Vector2 const size)
+{
+    size_t const index = layout->sizes.count;
+
+    mark_dirty(layout, index);
+    da_append(&layout->sizes, size);
+
+    return index;
+}
+
+void
+flow_layout_set_item_size(flow_layout_st * const layout, size_t const index, Vector2 const size)
+{
+    assert(index < layout->sizes.count);
+
+    Vector2 * const current = &layout->sizes.items[index];
+
+    if (current->x != size.x || current->y != size.y)
+    {
+        *current = size;
+        mark_dirty(layout, index);
+    }
+}
+
+void
+flow_layout_set_width(flow_layout_st * const layout, float const width)
+{
+    if (width != layout->width)
+    {
+        layout->width = width;
+        layout->width_changed = true;
+    }
+}
+
+size_t
+flow_layout_item_count(flow_layout_st const * const layout)
+{
+    return layout->sizes.count;
+}
+
+size_t
+flow_layout_row_count(flow_layout_st const * const layout)
+{
+    return layout->row_starts.count;
+}
+
+static void
+update_advance(flow_layout_st * const layout, size_t const from)
+{
+    size_t const count = layout->sizes.count;
+
+    da_resize(&layout->advance, count + 1);
+    for (size_t i = from; i < count; i++)
+    {
+        layout->advance.items[i + 1] =
+            layout->advance.items[i] + layout->sizes.items[i].x + layout->config.pad;
+    }
+}
+
+static void
+update_tallest(flow_layout_st * const layout, size_t const from)
+{
+    size_t const count = layout->sizes.count;
+    size_t levels = 1;
+
+    while (((size_t)1 << levels) <= count)
+    {
+        levels++;
+    }
+    while (layout->tallest.count < levels)
+    {
+        da_append(&layout->tallest, (floats_st){0});
+    }
+
+    floats_st * const base = &layout->tallest.items[0];
+
+    da_resize(base, count);
+    for (size_t i = from; i < count; i++)
+    {
+        base->items[i] = layout->sizes.items[i].y;
+    }
+
+    for (size_t k = 1; k < levels; k++)
+    {
+        size_t const span = (size_t)1 << k;
+        size_t const half = span / 2;
+        floats_st const * const below = &layout->tallest.items[k - 1];
+        floats_st * const level = &layout->tallest.items[k];
+        size_t const level_count = count - span + 1;
+        size_t const first = from >= span - 1 ? from - (span - 1) : 0;
+
+        da_resize(level, level_count);
+        for (size_t i = first; i < level_count; i++)
+        {
+            float const left = below->items[i];
+            float const right = below->items[i + half];
+
+            level->items[i] = left > right ? left : right;
+        }
+    }
+}
+
+static float
+tallest_in_range(flow_layout_st const * const layout, size_t const start, size_t const end)
+{
+    size_t const length = end - start;
+    size_t k = 0;
+
+    while (((size_t)2 << k) <= length)
+    {
+        k++;
+    }
+
+    floats_st const * const level = &layout->tallest.items[k];
+    float const left = level->items[start];
+    float const right = level->items[end - ((size_t)1 << k)];
+
+    return left > right ? left : right;
+}
+
+/*
+ * Find the end of the row starting at 'start'. Every row holds at least one
+ * item. Rows are short relative to the item count, so gallop forwards before
+ * bisecting.
+ */
+static size_t
+find_row_end(flow_layout_st const * const layout, size_t const start)
+{
+    float const * const advance = layout->advance.items;
+    float const limit = advance[start] + layout->width - layout->config.pad;
+    size_t const count = layout->sizes.count;
+    size_t low = start + 1;
+    size_t high = count;
+    size_t step = 1;
+
+    while (low + step < count && advance[low + step] <= limit)
+    {
+        low += step;
+        step *= 2;
+    }
+    if (low + step < count)
+    {
+        high = low + step - 1;
+    }
+
+    while (low < high)
+    {
+        size_t const mid = low + (high - low + 1) / 2;
+
+        if (advance[mid] <= limit)
+        {
+            low = mid;
+        }
+        else
+        {
+            high = mid - 1;
+        }
+    }
+
+    return low;
+}
+
+static size_t
+row_of_item(flow_layout_st const * const layout, size_t const index)
+{
+    size_t low = 0;
+    size_t high = layout->row_starts.count - 1;
+
+    while (low < high)
+    {
+        size_t const mid = low + (high - low + 1) / 2;
+
+        if (layout->row_starts.items[mid] <= index)
+        {
+            low = mid;
+        }
+        else
+        {
+            high = mid - 1;
+        }
+    }
+
+    return low;
+}
+
+static size_t
+row_end(flow_layout_st const * const layout, size_t const row)
+{
+    if (row + 1 < layout->row_starts.count)
+    {
+        return layout->row_starts.items[row + 1];
+    }
+
+    return layout->sizes.count;
+}
+
+static void
+append_row(flow_layout_st * const layout, size_t const start, size_t const end)
+{
+    float const pad = layout->config.pad;
+    float y = pad;
+
+    if (layout->row_y.count > 0)
+    {
+        y = da_last(&layout->row_y) + da_last(&layout->row_heights) + pad;
+    }
+
+    float height = tallest_in_range(layout, start, end);
+
+    if (height < layout->config.min_row_height)
+    {
+        height = layout->config.min_row_height;
+    }
+
+    da_append(&layout->row_starts, start);
+    da_append(&layout->row_y, y);
+    da_append(&layout->row_heights, height);
+}
+
+/*
+ * Rebuild rows from the first row that can be affected. Returns the first
+ * item whose position changed.
+ *
+ * A change to the first item of a row can let it move up to the end of the
+ * previous row, so rebuilding starts from the row holding the item before
+ * the first dirty one.
+ */
+static size_t
+update_rows(flow_layout_st * const layout, size_t const first_dirty_item)
+{
+    size_t const count = layout->sizes.count;
+    size_t first_row = 0;
+
+    if (!layout->width_changed && layout->row_starts.count > 0)
+    {
+        size_t const dirty = first_dirty_item < count ? first_dirty_item : count - 1;
+
+        first_row = dirty > 0 ? row_of_item(layout, dirty - 1) : 0;
+    }
+
+    /* Keep the old breaks of the rows being rebuilt so unmoved items can be reported. */
+    indexes_st * const old_ends = &layout->previous_row_ends;
+
+    old_ends->count = 0;
+    for (size_t row = first_row; row < layout->row_starts.count; row++)
+    {
+        da_append(old_ends, row_end(layout, row));
+    }
+
+    size_t start = first_row > 0 ? row_end(layout, first_row - 1) : 0;
+    size_t first_moved = first_dirty_item;
+
+    layout->row_starts.count = first_row;
+    layout->row_y.count = first_row;
+    layout->row_heights.count = first_row;
+
+    for (size_t row = first_row; start < count; row++)
+    {
+        size_t const end = find_row_end(layout, start);
+        size_t const old_index = row - first_row;
+        bool const same_row = old_index < old_ends->count && old_ends->items[old_index] == end;
+
+        if (!same_row)
+        {
+            size_t const old_end = old_index < old_ends->count ? old_ends->items[old_index] : end;
+            size_t const stable_end = old_end < end ? old_end : end;
+
+            if (stable_end < first_moved)
+            {
+                first_moved = stable_end;
+            }
+        }
+        append_row(layout, start, end);
+        start = end;
+    }
+
+    return first_moved;
+}
+
+size_t
+flow_layout_update(flow_layout_st * const layout)
+{
+    size_t const count = layout->sizes.count;
+    size_t const dirty_from = layout->dirty_from;
+    bool const sizes_changed = dirty_from < count;
+
+    if (!sizes_changed && !layout->width_changed)
+    {
+        return count;
+    }
+    if (sizes_changed)
+    {
+        update_advance(layout, dirty_from);
+        update_tallest(layout, dirty_from);
+    }
+
+    size_t const first_moved = count > 0 ? update_rows(layout, dirty_from) : count;
+
+    layout->dirty_from = count;
+    layout->width_changed = false;
+
+    return first_moved;
+}
+
+Rectangle
+flow_layout_item_rect(flow_layout_st const * const layout, size_t const index)
+{
+    assert(index < layout->sizes.count);
+    assert(layout->dirty_from >= layout->sizes.count && !layout->width_changed);
+
+    size_t const row = row_of_item(layout, index);
+    size_t const row_start = layout->row_starts.items[row];
+    Vector2 const size = layout->sizes.items[index];
+    float const x =
+        layout->config.pad + layout->advance.items[index] - layout->advance.items[row_start];
+
+    return (Rectangle){
+        .x = x,
+        .y = layout->row_y.items[row],
+        .width = size.x,
+        .height = size.y,
+    };
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <raylib.h>
+
+#include <stddef.h>
+
+/*
+ * Lays items of varying size out left to right, wrapping into rows that fit
+ * within a given width. Items are top aligned within their row.
+ *
+ * Results are cached. Changing an item size only recomputes from that item
+ * onwards, and changing the width only recomputes the row breaks, which is
+ * O(rows * log(items)) rather than O(items). Item positions are derived on
+ * demand from the cached rows.
+ */
+
+typedef struct
+{
+    /* Gap around the edges and between items and rows. */
+    float pad;
+    float min_row_height;
+} flow_layout_config_st;
+
+typedef struct flow_layout_st flow_layout_st;
+
+flow_layout_st *
+flow_layout_new(flow_layout_config_st const * config, float width);
+
+void
+flow_layout_free(flow_layout_st * layout);
+
+/* Returns the index of the new item. */
+size_t
+flow_layout_add_item(flow_layout_st * layout, Vector2 size);
+
+void
+flow_layout_set_item_size(flow_layout_st * layout, size_t index, Vector2 size);
+
+void
+flow_layout_set_width(flow_layout_st * layout, float width);
+
+size_t
+flow_layout_item_count(flow_layout_st const * layout);
+
+/*
+ * Bring the cached layout up to date. Returns the index of the first item
+ * whose position may have changed since the previous update; items before it
+ * are guaranteed not to have moved. Returns the item count if nothing moved.
+ */
+size_t
+flow_layout_update(flow_layout_st * layout);
+
+/* The layout must be up to date. */
+Rectangle
+flow_layout_item_rect(flow_layout_st const * layout, size_t index);
+
+size_t
+flow_layout_row_count(flow_layout_st const * layout);
@@ -0,0 +1,118 @@
+#include "frame_governor.h"
+
+#include "utils.h"
+
+static float const smoothing = 0.1f;
+
+/* Ordered from full quality to the cheapest level. */
+static FrameQuality const quality_levels[] =
+{
+    {.low_priority_update_interval = 1, .draw_fraction = 1.f, .optional_effects = true},
+    {.low_priority_update_interval = 1, .draw_fraction = 1.f, .optional_effects = false},
+    {.low_priority_update_interval = 2, .draw_fraction = 1.f, .optional_effects = false},
+    {.low_priority_update_interval = 2, .draw_fraction = .5f, .optional_effects = false},
+    {.low_priority_update_interval = 4, .draw_fraction = .25f, .optional_effects = false},
+};
+
+void
+frame_governor_init(
+    frame_governor_st * const governor, frame_governor_config_st const * const config
+)
+{
+    *governor = (frame_governor_st){.config = *config, .reseed_work = true};
+}
+
+static void
+change_level(frame_governor_st * const governor, size_t const level)
+{
+    if (level > governor->level)
+    {
+        governor->counters.degrades++;
+    }
+    else
+    {
+        governor->counters.restores++;
+    }
+    governor->level = level;
+    /*
+     * The work averaged so far was done at the old level. Carrying it over
+     * would keep the governor over budget for several more frames and cause
+     * a second, spurious, degrade.
+     */
+    governor->reseed_work = true;
+    governor->frames_over = 0;
+    governor->frames_under = 0;
+}
+
+void
+frame_governor_end_frame(frame_governor_st * const governor, FrameTimings const timings)
+{
+    frame_governor_config_st const * const config = &governor->config;
+    float const work = timings.update + timings.draw;
+
+    if (governor->reseed_work)
+    {
+        governor->smoothed_work = work;
+        governor->reseed_work = false;
+    }
+    governor->smoothed_work += (work - governor->smoothed_work) * smoothing;
+    governor->counters.frames++;
+
+    if (work > config->budget)
+    {
+        governor->counters.frames_over_budget++;
+    }
+
+    bool const over_budget = governor->smoothed_work > config->budget;
+    bool const has_headroom = governor->smoothed_work < config->budget * config->restore_ratio;
+
+    governor->frames_over = over_budget ? governor->frames_over + 1 : 0;
+    governor->frames_under = has_headroom ? governor->frames_under + 1 : 0;
+
+    bool const can_degrade = governor->level + 1 < ARRAY_SIZE(quality_levels);
+
+    if (can_degrade && governor->frames_over >= config->frames_to_degrade)
+    {
+        change_level(governor, governor->level + 1);
+    }
+    else if (governor->level > 0 && governor->frames_under >= config->frames_to_restore)
+    {
+        change_level(governor, governor->level - 1);
+    }
+}
+
+FrameQuality
+frame_governor_quality(frame_governor_st const * const governor)
+{
+    FrameQuality quality = quality_levels[governor->level];
+
+    quality.level = governor->level;
+
+    return quality;
+}
+
+PacedUpdate
+frame_pacer_tick(
+    frame_pacer_st * const pacer, frame_governor_st * const governor, DeltaTime const delta
+)
+{
+    size_t const interval = quality_levels[governor->level].low_priority_update_interval;
+
+    pacer->pending_delta += delta.value;
+    pacer->frames_waited++;
+
+    if (pacer->frames_waited < interval)
+    {
+        governor->counters.skipped_updates++;
+
+        return (PacedUpdate){.run = false};
+    }
+
+    PacedUpdate const update = {.run = true, .delta = {pacer->pending_delta}};
+
+    pacer->pending_delta = 0.f;
+    pacer->frames_waited = 0;
+
+    return update;
+}
+
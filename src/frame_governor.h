@@ -0,0 +1,85 @@
+#pragma once
+
+#include "environment.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+ * Holds the time spent updating and drawing each frame within a budget by
+ * stepping through progressively cheaper quality levels when the budget is
+ * overrun, and back up again once there is headroom. Level changes need the
+ * condition to hold for several consecutive frames so that a single slow
+ * frame does not cause quality to oscillate.
+ */
+
+typedef struct
+{
+    /* Seconds of update and draw work allowed per frame. */
+    float budget;
+    /* Quality is only restored while work is below this fraction of the budget. */
+    float restore_ratio;
+    size_t frames_to_degrade;
+    size_t frames_to_restore;
+} frame_governor_config_st;
+
+typedef struct
+{
+    size_t frames;
+    size_t frames_over_budget;
+    size_t degrades;
+    size_t restores;
+    size_t skipped_updates;
+} frame_governor_counters_st;
+
+typedef struct
+{
+    frame_governor_config_st config;
+    frame_governor_counters_st counters;
+    size_t level;
+    float smoothed_work;
+    /*
+     * Set when 'smoothed_work' no longer reflects the current level, so that
+     * the next frame's work replaces it rather than being averaged in.
+     */
+    bool reseed_work;
+    size_t frames_over;
+    size_t frames_under;
+} frame_governor_st;
+
+typedef struct
+{
+    float update;
+    float draw;
+} FrameTimings;
+
+/* Tracks the time that a low priority module has not yet been updated for. */
+typedef struct
+{
+    float pending_delta;
+    size_t frames_waited;
+} frame_pacer_st;
+
+typedef struct
+{
+    bool run;
+    DeltaTime delta;
+} PacedUpdate;
+
+void
+frame_governor_init(frame_governor_st * governor, frame_governor_config_st const * config);
+
+/* Record the work done in the frame just finished and adjust the quality level. */
+void
+frame_governor_end_frame(frame_governor_st * governor, FrameTimings timings);
+
+FrameQuality
+frame_governor_quality(frame_governor_st const * governor);
+
+/*
+ * Decide whether a low priority module is updated this frame. Skipped time
+ * is accumulated and handed over on the next update so nothing is lost.
+ */
+PacedUpdate
+frame_pacer_tick(frame_pacer_st * pacer, frame_governor_st * governor, DeltaTime delta);
+
@@ -0,0 +1,219 @@
+#include "golden.h"
+
+#include "animation1.h"
+#include "animation2.h"
+#include "animation_modules.h"
+#include "button1.h"
+#include "environment.h"
+#include "image_compare.h"
+#include "software_renderer.h"
+#include "utils.h"
+
+#include <raylib.h>
+
+#include <stdbool.h>
+#include <stdio.h>
+
+typedef struct
+{
+    char const * name;
+    animation_handlers_st const * (*get_handlers)(void);
+    void * (*init)(void);
+} golden_scene_st;
+
+static golden_scene_st const scenes[] =
+{
+    {.name = "squares", .get_handlers = get_animation1_animation_handlers, .init = animation1_init},
+    {.name = "timeline", .get_handlers = get_animation2_animation_handlers, .init = animation2_init},
+};
+
+static size_t const captured_frames[] = {0, 20, 60, 150, 300};
+
+static ScreenSize const screen = {.width = 800.f, .height = 600.f};
+static DeltaTime const timestep = {1.f / 60.f};
+
+static image_compare_config_st const compare_config = {
+    .channel_tolerance = 8,
+    .max_differing_pixels = 16,
+};
+
+static void
+image_path(
+    char * const path,
+    size_t const size,
+    char const * const directory,
+    char const * const scene_name,
+    size_t const frame,
+    char const * const suffix
+)
+{
+    snprintf(path, size, "%s/%s_%03zu%s.png", directory, scene_name, frame, suffix);
+}
+
+static bool
+check_image(
+    golden_directories_st const * const directories,
+    char const * const scene_name,
+    size_t const frame,
+    Image const actual
+)
+{
+    char golden_path[512];
+
+    image_path(golden_path, sizeof(golden_path), directories->golden, scene_name, frame, "");
+    if (!FileExists(golden_path))
+    {
+        printf("%s: missing golden image\n", golden_path);
+        return false;
+    }
+
+    Image expected = LoadImage(golden_path);
+
+    ImageFormat(&expected, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    ImageComparison const comparison = image_compare(expected, actual, &compare_config);
+
+    if (!comparison.matches)
+    {
+        char actual_path[512];
+        char diff_path[512];
+
+        image_path(
+            actual_path, sizeof(actual_path), directories->output, scene_name, frame, "_actual"
+        );
+        image_path(diff_path, sizeof(diff_path), directories->output, scene_name, frame, "_diff");
+        ExportImage(actual, actual_path);
+
+        if (comparison.same_size)
+        {
+            Image const diff = image_diff(expected, actual, &compare_config);
+
+            ExportImage(diff, diff_path);
+            UnloadImage(diff);
+            printf(
+                "%s: %zu pixels differ (max channel difference %d), see %s\n",
+                golden_path,
+                comparison.differing_pixels,
+                comparison.max_channel_difference,
+                diff_path
+            );
+        }
+        else
+        {
+            printf("%s: image size differs, see %s\n", golden_path, actual_path);
+        }
+    }
+    UnloadImage(expected);
+
+    return comparison.matches;
+}
+
+static bool
+process_frame(
+    golden_directories_st const * const directories,
+    char const * const scene_name,
+    size_t const frame,
+    Image const image,
+    golden_mode const mode
+)
+{
+    if (mode == GOLDEN_MODE_CHECK)
+    {
+        return check_image(directories, scene_name, frame, image);
+    }
+
+    char golden_path[512];
+
+    image_path(golden_path, sizeof(golden_path), directories->golden, scene_name, frame, "");
+    if (!ExportImage(image, golden_path))
+    {
+        printf("%s: failed to write golden image\n", golden_path);
+        return false;
+    }
+
+    return true;
+}
+
+static bool
+is_captured(size_t const frame)
+{
+    for (size_t i = 0; i < ARRAY_SIZE(captured_frames); i++)
+    {
+        if (captured_frames[i] == frame)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static size_t
+run_scene(
+    golden_scene_st const * const scene,
+    golden_directories_st const * const directories,
+    golden_mode const mode,
+    software_renderer_st * const software
+)
+{
+    animation_handlers_st const * const scene_handlers = scene->get_handlers();
+    void * const scene_ctx = scene->init();
+    animation_handlers_st const * const button_handlers = get_button_animation_handlers();
+    void * const button = button1_init(0.5f, 0.5f, 100.f, 50.f);
+    renderer_st const * const renderer = software_renderer_renderer(software);
+    size_t const last_frame = captured_frames[ARRAY_SIZE(captured_frames) - 1];
+    size_t failures = 0;
+
+    for (size_t frame = 0; frame <= last_frame; frame++)
+    {
+        Environment const env = {
+            .delta = timestep,
+            .screen = screen,
+            /* Modules are initialised without a window, so lay them out on the first frame. */
+            .resized = frame == 0,
+            .quality = {.low_priority_update_interval = 1, .draw_fraction = 1.f},
+        };
+
+        scene_handlers->update(scene_ctx, &env);
+        button_handlers->update(button, &env);
+
+        if (!is_captured(frame))
+        {
+            continue;
+        }
+
+        renderer->handlers->clear(renderer->ctx, RAYWHITE);
+        scene_handlers->draw(scene_ctx, renderer);
+        button_handlers->draw(button, renderer);
+
+        Image const image = software_renderer_image(software);
+
+        if (!process_frame(directories, scene->name, frame, image, mode))
+        {
+            failures++;
+        }
+    }
+
+    scene_handlers->free(scene_ctx);
+    button_handlers->free(button);
+
+    return failures;
+}
+
+size_t
+golden_run(golden_directories_st const * const directories, golden_mode const mode)
+{
+    software_renderer_st * const software = software_renderer_new(screen.width, screen.height);
+    size_t failures = 0;
+
+    for (size_t i = 0; i < ARRAY_SIZE(scenes); i++)
+    {
+        failures += run_scene(&scenes[i], directories, mode, software);
+    }
+    software_renderer_free(software);
+
+    printf("golden images: %zu failure(s)\n", failures);
+
+    return failures;
+}
+
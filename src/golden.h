@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stddef.h>
+
+/*
+ * Headless golden-image checks. Each scene is stepped at a fixed timestep,
+ * rendered with the software renderer at a few chosen frames, and compared
+ * against the PNG images stored in a directory. A mismatch writes the actual
+ * image and a diff image to a separate output directory, so that checking
+ * never writes into the source tree.
+ */
+
+typedef struct
+{
+    /* The reference images. Written in GOLDEN_MODE_UPDATE. */
+    char const * golden;
+    /* Where a failed check writes its actual and diff images. Must exist. */
+    char const * output;
+} golden_directories_st;
+
+typedef enum
+{
+    GOLDEN_MODE_CHECK,
+    /* Write the current output as the new golden images. */
+    GOLDEN_MODE_UPDATE,
+} golden_mode;
+
+/* Returns the number of frames that failed. */
+size_t
+golden_run(golden_directories_st const * directories, golden_mode mode);
+
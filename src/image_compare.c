@@ -0,0 +1,110 @@
+#include "image_compare.h"
+
+#include "utils.h"
+
+#include <raylib.h>
+
+#include <assert.h>
+#include <stdlib.h>
+
+static int
+channel_difference(unsigned char const a, unsigned char const b)
+{
+    return abs((int)a - (int)b);
+}
+
+static int
+pixel_difference(Color const a, Color const b)
+{
+    int difference = channel_difference(a.r, b.r);
+    int const channels[] = {
+        channel_difference(a.g, b.g),
+        channel_difference(a.b, b.b),
+        channel_difference(a.a, b.a),
+    };
+
+    for (size_t i = 0; i < ARRAY_SIZE(channels); i++)
+    {
+        if (channels[i] > difference)
+        {
+            difference = channels[i];
+        }
+    }
+
+    return difference;
+}
+
+static size_t
+pixel_count(Image const image)
+{
+    return (size_t)image.width * image.height;
+}
+
+ImageComparison
+image_compare(
+    Image const expected, Image const actual, image_compare_config_st const * const config
+)
+{
+    ImageComparison comparison = {
+        .same_size = expected.width == actual.width && expected.height == actual.height,
+    };
+
+    if (!comparison.same_size)
+    {
+        return comparison;
+    }
+
+    assert(expected.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    assert(actual.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    Color const * const expected_pixels = expected.data;
+    Color const * const actual_pixels = actual.data;
+
+    for (size_t i = 0; i < pixel_count(expected); i++)
+    {
+        int const difference = pixel_difference(expected_pixels[i], actual_pixels[i]);
+
+        if (difference > comparison.max_channel_difference)
+        {
+            comparison.max_channel_difference = difference;
+        }
+        if (difference > config->channel_tolerance)
+        {
+            comparison.differing_pixels++;
+        }
+    }
+    comparison.matches = comparison.differing_pixels <= config->max_differing_pixels;
+
+    return comparison;
+}
+
+Image
+image_diff(Image const expected, Image const actual, image_compare_config_st const * const config)
+{
+    assert(expected.width == actual.width && expected.height == actual.height);
+
+    Image const diff = GenImageColor(expected.width, expected.height, BLANK);
+    Color * const diff_pixels = diff.data;
+    Color const * const expected_pixels = expected.data;
+    Color const * const actual_pixels = actual.data;
+
+    for (size_t i = 0; i < pixel_count(expected); i++)
+    {
+        Color const e = expected_pixels[i];
+        int const difference = pixel_difference(e, actual_pixels[i]);
+
+        if (difference > config->channel_tolerance)
+        {
+            diff_pixels[i] = RED;
+        }
+        else
+        {
+            unsigned char const grey = (unsigned char)(191 + (e.r + e.g + e.b) / 12);
+
+            diff_pixels[i] = (Color){grey, grey, grey, 255};
+        }
+    }
+
+    return diff;
+}
+
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <raylib.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct
+{
+    /* Largest per-channel difference for a pixel to still count as equal. */
+    int channel_tolerance;
+    /* Images match when at most this many pixels differ. */
+    size_t max_differing_pixels;
+} image_compare_config_st;
+
+typedef struct
+{
+    bool matches;
+    bool same_size;
+    size_t differing_pixels;
+    int max_channel_difference;
+} ImageComparison;
+
+/* Both images must be in R8G8B8A8 format. */
+ImageComparison
+image_compare(Image expected, Image actual, image_compare_config_st const * config);
+
+/*
+ * Build an image showing where 'actual' differs from 'expected': differing
+ * pixels are red and matching ones a faded copy of 'expected'. The caller
+ * unloads the result. The images must be the same size.
+ */
+Image
+image_diff(Image expected, Image actual, image_compare_config_st const * config);
+
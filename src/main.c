@@ -1,14 +1,133 @@
 #include "animation1.h"
+#include "animation2.h"
 #include "animation_modules.h"
 #include "button1.h"
+#include "environment.h"
+#include "frame_governor.h"
+#include "golden.h"
+#include "renderer.h"
+#include "resize_coalescer.h"
 
 #include <raylib.h>
+#include <rlgl.h>
 
-int main(void)
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void
+spawn_square_burst(void * const ctx, Vector2 const position)
+{
+    size_t const burst_size = 8;
+    float const square_size = 20.f;
+
+    for (size_t i = 0; i < burst_size; i++)
+    {
+        square_spawn_params_st const params = {
+            .pos_x = position.x + i * (square_size + 5.f),
+            .pos_y = position.y,
+            .max_size = square_size,
+            .color = DARKBLUE,
+            .start_delay = i * 0.05f,
+            .despawn_when_done = true,
+        };
+
+        animation1_spawn(ctx, &params);
+    }
+}
+
+static ScreenSize
+get_screen_size(void)
+{
+    return (ScreenSize){.width = GetScreenWidth(), .height = GetScreenHeight()};
+}
+
+/* The counters are drawn at every quality level. Only the FPS counter is optional. */
+static void
+draw_governor_stats(frame_governor_st const * const governor, FrameQuality const quality)
+{
+    frame_governor_counters_st const * const counters = &governor->counters;
+
+    if (quality.optional_effects)
+    {
+        DrawFPS(10, 10);
+    }
+    DrawText(
+        TextFormat(
+            "quality %zu  over budget %zu  degrades %zu  restores %zu  skipped %zu",
+            governor->level,
+            counters->frames_over_budget,
+            counters->degrades,
+            counters->restores,
+            counters->skipped_updates
+        ),
+        10,
+        32,
+        10,
+        DARKGRAY
+    );
+}
+
+/*
+ * Handle the headless golden-image options:
+ *   --check-golden <golden dir> [<output dir>]
+ *   --update-golden <golden dir>
+ * A failed check writes its images to the output directory, which defaults
+ * to the working directory. Returns true with the process exit status in
+ * 'exit_status' if one of the options was given.
+ */
+static bool
+run_golden_command(int const argc, char * * const argv, int * const exit_status)
+{
+    if (argc != 3 && argc != 4)
+    {
+        return false;
+    }
+
+    golden_mode mode;
+
+    if (strcmp(argv[1], "--check-golden") == 0)
+    {
+        mode = GOLDEN_MODE_CHECK;
+    }
+    else if (strcmp(argv[1], "--update-golden") == 0)
+    {
+        mode = GOLDEN_MODE_UPDATE;
+    }
+    else
+    {
+        return false;
+    }
+
+    if (mode == GOLDEN_MODE_UPDATE && argc != 3)
+    {
+        return false;
+    }
+
+    golden_directories_st const directories = {
+        .golden = argv[2],
+        .output = argc == 4 ? argv[3] : ".",
+    };
+
+    *exit_status = golden_run(&directories, mode) == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+
+    return true;
+}
+
+int main(int argc, char * * argv)
 {
+    int exit_status;
+
+    if (run_golden_command(argc, argv, &exit_status))
+    {
+        return exit_status;
+    }
+
     int const screenWidth = 800;
     int const screenHeight = 600;
 
+    SetConfigFlags(FLAG_WINDOW_RESIZABLE);
     InitWindow(screenWidth, screenHeight, "Animation");
 
     SetTargetFPS(60);
@@ -16,45 +135,142 @@ int main(void)
     animation_handlers_st const * const animation1_handlers = get_animation1_animation_handlers();
     void * const ctx = animation1_init();
 
-    float const screen_width = GetScreenWidth();
-    float const screen_height = GetScreenHeight();
+    animation_handlers_st const * const animation2_handlers = get_animation2_animation_handlers();
+    void * const ctx2 = animation2_init();
+    bool show_timeline_scene = false;
+    /* The scene is paced, so it may not see the frame a resize is delivered on. */
+    bool scene_resize_pending = false;
+
     float const button_height = 50.f;
     float const button_width = 100.f;
-    float const button_x = (screen_width - button_width) / 2.f;
-    float const button_y = (screen_height - button_height) / 2.f;
 
     animation_handlers_st const * const button_handlers = get_button_animation_handlers();
-    void * const button = button1_init(button_x, button_y, button_width, button_height);
+    void * const button = button1_init(0.5f, 0.5f, button_width, button_height);
+
+    resize_coalescer_config_st const resize_config = {
+        .settle_time = 0.1f,
+        .max_delay = 0.5f,
+    };
+    resize_coalescer_st resize_coalescer;
+
+    resize_coalescer_init(&resize_coalescer, &resize_config, get_screen_size());
+
+    frame_governor_config_st const governor_config = {
+        .budget = 0.012f,
+        .restore_ratio = 0.6f,
+        .frames_to_degrade = 10,
+        .frames_to_restore = 120,
+    };
+    frame_governor_st governor;
+    /* The scenes are low priority. Input handling is always updated. */
+    frame_pacer_st scene_pacer = {0};
+
+    frame_governor_init(&governor, &governor_config);
+
+    renderer_st const * const renderer = get_raylib_renderer();
 
     // Main game loop
     while (!WindowShouldClose())
     {
+        DeltaTime const delta = {GetFrameTime()};
+        ResizeEvent const resize =
+            resize_coalescer_update(&resize_coalescer, get_screen_size(), delta);
+        FrameQuality const quality = frame_governor_quality(&governor);
         Environment const env = {
-            .delta = {GetFrameTime()},
+            .delta = delta,
+            .screen = resize.size,
+            .resized = resize.resized,
+            .quality = quality,
         };
+        double const update_start = GetTime();
+
+        scene_resize_pending = scene_resize_pending || resize.resized;
+
+        animation_handlers_st const * const scene_handlers =
+            show_timeline_scene ? animation2_handlers : animation1_handlers;
+        void * const scene = show_timeline_scene ? ctx2 : ctx;
 
         if (IsKeyPressed(KEY_R))
         {
-            animation1_handlers->reset(ctx);
+            scene_handlers->reset(scene);
         }
+        if (IsKeyPressed(KEY_S) && !show_timeline_scene)
+        {
+            spawn_square_burst(ctx, GetMousePosition());
+        }
+        if (IsKeyPressed(KEY_T))
+        {
+            show_timeline_scene = !show_timeline_scene;
+            /* The scene being shown may have been hidden during a resize. */
+            scene_resize_pending = true;
+        }
+
+        PacedUpdate const scene_update = frame_pacer_tick(&scene_pacer, &governor, delta);
 
-        animation1_handlers->update(ctx, &env);
+        if (scene_update.run)
+        {
+            Environment const scene_env = {
+                .delta = scene_update.delta,
+                .screen = resize.size,
+                .resized = scene_resize_pending,
+                .quality = quality,
+            };
+
+            scene_resize_pending = false;
+            scene_handlers->update(scene, &scene_env);
+        }
         button_handlers->update(button, &env);
 
+        double const draw_start = GetTime();
+
         BeginDrawing();
 
-            ClearBackground(RAYWHITE);
+            renderer->handlers->clear(renderer->ctx, RAYWHITE);
 
             //DrawText("Hello, World!", 190, 200, 20, LIGHTGRAY);
-            animation1_handlers->draw(ctx);
-            button_handlers->draw(button);
+            scene_handlers->draw(scene, renderer);
+            button_handlers->draw(button, renderer);
+            draw_governor_stats(&governor, quality);
+
+        /*
+         * Flush the batched draw calls to the GPU so that their cost is
+         * counted. EndDrawing() then only swaps buffers and waits for the
+         * target frame rate, which isn't counted as work.
+         */
+        rlDrawRenderBatchActive();
+        double const draw_end = GetTime();
 
         EndDrawing();
+
+        FrameTimings const timings = {
+            .update = draw_start - update_start,
+            .draw = draw_end - draw_start,
+        };
+
+        frame_governor_end_frame(&governor, timings);
+
+        FrameQuality const next_quality = frame_governor_quality(&governor);
+
+        if (next_quality.level != quality.level)
+        {
+            TraceLog(
+                LOG_INFO,
+                "GOVERNOR: Quality level %zu -> %zu "
+                "(over budget %zu, degrades %zu, restores %zu, skipped %zu)",
+                quality.level,
+                next_quality.level,
+                governor.counters.frames_over_budget,
+                governor.counters.degrades,
+                governor.counters.restores,
+                governor.counters.skipped_updates
+            );
+        }
     }
 
     CloseWindow();        // Close window and OpenGL context
 
     animation1_handlers->free(ctx);
+    animation2_handlers->free(ctx2);
     button_handlers->free(button);
 
     return 0;
@@ -0,0 +1,57 @@
+#include "renderer.h"
+
+#include "utils.h"
+
+#include <raylib.h>
+
+#include <stddef.h>
+
+static void
+raylib_clear(void * const ctx, Color const color)
+{
+    UNUSED_PARAM(ctx);
+
+    ClearBackground(color);
+}
+
+static void
+raylib_rectangle(void * const ctx, Rectangle const rec, Color const color)
+{
+    UNUSED_PARAM(ctx);
+
+    DrawRectangleRec(rec, color);
+}
+
+static void
+raylib_rectangle_pro(
+    void * const ctx,
+    Rectangle const rec,
+    Vector2 const origin,
+    float const rotation,
+    Color const color
+)
+{
+    UNUSED_PARAM(ctx);
+
+    DrawRectanglePro(rec, origin, rotation, color);
+}
+
+static renderer_handlers_st const
+raylib_renderer_handlers = {
+    .clear = raylib_clear,
+    .rectangle = raylib_rectangle,
+    .rectangle_pro = raylib_rectangle_pro,
+};
+
+static renderer_st const
+raylib_renderer = {
+    .handlers = &raylib_renderer_handlers,
+    .ctx = NULL,
+};
+
+renderer_st const *
+get_raylib_renderer(void)
+{
+    return &raylib_renderer;
+}
+
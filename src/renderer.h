@@ -0,0 +1,37 @@
+#pragma once
+
+#include <raylib.h>
+
+/*
+ * The drawing primitives used by the animation modules. Modules draw through
+ * this interface so that a frame can be rendered either to the window or,
+ * headless, to an image in memory.
+ */
+
+typedef void
+(*renderer_clear_fn)(void * ctx, Color color);
+
+typedef void
+(*renderer_rectangle_fn)(void * ctx, Rectangle rec, Color color);
+
+/* Same semantics as raylib's DrawRectanglePro(). */
+typedef void
+(*renderer_rectangle_pro_fn)(
+    void * ctx, Rectangle rec, Vector2 origin, float rotation, Color color
+);
+
+typedef struct renderer_handlers_st {
+    renderer_clear_fn clear;
+    renderer_rectangle_fn rectangle;
+    renderer_rectangle_pro_fn rectangle_pro;
+} renderer_handlers_st;
+
+typedef struct renderer_st {
+    renderer_handlers_st const * handlers;
+    void * ctx;
+} renderer_st;
+
+/* Draws to the raylib window. */
+renderer_st const *
+get_raylib_renderer(void);
+
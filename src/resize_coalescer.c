@@ -0,0 +1,66 @@
+#include "resize_coalescer.h"
+
+static bool
+same_size(ScreenSize const a, ScreenSize const b)
+{
+    return a.width == b.width && a.height == b.height;
+}
+
+void
+resize_coalescer_init(
+    resize_coalescer_st * const coalescer,
+    resize_coalescer_config_st const * const config,
+    ScreenSize const initial
+)
+{
+    *coalescer = (resize_coalescer_st){
+        .config = *config,
+        .reported = initial,
+        .latest = initial,
+    };
+}
+
+ResizeEvent
+resize_coalescer_update(
+    resize_coalescer_st * const coalescer, ScreenSize const current, DeltaTime const delta
+)
+{
+    if (!same_size(current, coalescer->latest))
+    {
+        coalescer->latest = current;
+        coalescer->time_since_change = 0.f;
+        if (!coalescer->pending)
+        {
+            coalescer->pending = true;
+            coalescer->time_pending = 0.f;
+        }
+    }
+    else if (coalescer->pending)
+    {
+        coalescer->time_since_change += delta.value;
+    }
+
+    if (!coalescer->pending)
+    {
+        return (ResizeEvent){.resized = false, .size = coalescer->reported};
+    }
+    coalescer->time_pending += delta.value;
+
+    bool const settled = coalescer->time_since_change >= coalescer->config.settle_time;
+    bool const overdue = coalescer->time_pending >= coalescer->config.max_delay;
+
+    if (!settled && !overdue)
+    {
+        return (ResizeEvent){.resized = false, .size = coalescer->reported};
+    }
+
+    coalescer->pending = false;
+
+    /* A drag that ends where it started needs no relayout. */
+    bool const resized = !same_size(coalescer->latest, coalescer->reported);
+
+    coalescer->reported = coalescer->latest;
+
+    return (ResizeEvent){.resized = resized, .size = coalescer->reported};
+}
+
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "environment.h"
+
+#include <stdbool.h>
+
+/*
+ * Turns the stream of sizes seen while a window edge is being dragged into
+ * a few resize events. A change is reported once the size has stopped
+ * changing for 'settle_time' seconds, or after 'max_delay' seconds at the
+ * latest so that a long drag still refreshes occasionally.
+ */
+
+typedef struct
+{
+    float settle_time;
+    float max_delay;
+} resize_coalescer_config_st;
+
+typedef struct
+{
+    resize_coalescer_config_st config;
+    ScreenSize reported;
+    ScreenSize latest;
+    bool pending;
+    float time_since_change;
+    float time_pending;
+} resize_coalescer_st;
+
+typedef struct
+{
+    bool resized;
+    ScreenSize size;
+} ResizeEvent;
+
+void
+resize_coalescer_init(
+    resize_coalescer_st * coalescer, resize_coalescer_config_st const * config, ScreenSize initial
+);
+
+ResizeEvent
+resize_coalescer_update(resize_coalescer_st * coalescer, ScreenSize current, DeltaTime delta);
+
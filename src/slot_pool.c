@@ -0,0 +1,71 @@
+#include "slot_pool.h"
+
+#include "dynamic_array.h"
+
+slot_handle_st
+slot_pool_acquire(slot_pool_st * const pool)
+{
+    uint32_t index;
+
+    if (pool->free_head != 0)
+    {
+        index = pool->free_head - 1;
+        pool->free_head = pool->items[index].next_free;
+    }
+    else
+    {
+        slot_st const slot = {.generation = 1};
+
+        index = pool->count;
+        da_append(pool, slot);
+    }
+
+    slot_st * const slot = &pool->items[index];
+
+    slot->in_use = true;
+    slot->next_free = 0;
+
+    return (slot_handle_st){.index = index, .generation = slot->generation};
+}
+
+bool
+slot_pool_is_live(slot_pool_st const * const pool, slot_handle_st const handle)
+{
+    if (handle.index >= pool->count)
+    {
+        return false;
+    }
+
+    slot_st const * const slot = &pool->items[handle.index];
+
+    return slot->in_use && slot->generation == handle.generation;
+}
+
+bool
+slot_pool_release(slot_pool_st * const pool, slot_handle_st const handle)
+{
+    if (!slot_pool_is_live(pool, handle))
+    {
+        return false;
+    }
+
+    slot_st * const slot = &pool->items[handle.index];
+
+    slot->in_use = false;
+    slot->generation++;
+    if (slot->generation == 0)
+    {
+        slot->generation = 1;
+    }
+    slot->next_free = pool->free_head;
+    pool->free_head = handle.index + 1;
+
+    return true;
+}
+
+void
+slot_pool_free(slot_pool_st * const pool)
+{
+    da_free(*pool);
+    *pool = (slot_pool_st){0};
+}
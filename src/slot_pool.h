@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Hands out reusable slot indexes from a free list. Each slot carries a
+ * generation that is bumped when the slot is released, so a stale handle to
+ * a recycled slot is detected rather than silently aliasing the new owner.
+ * Generation 0 is never issued, so a zeroed handle is always invalid.
+ */
+
+typedef struct
+{
+    uint32_t index;
+    uint32_t generation;
+} slot_handle_st;
+
+typedef struct
+{
+    uint32_t generation;
+    uint32_t next_free;
+    bool in_use;
+} slot_st;
+
+typedef struct slot_pool_st {
+    slot_st * items;
+    size_t count;
+    size_t capacity;
+    /* Index + 1 of the first free slot, or 0 if there are none. */
+    uint32_t free_head;
+} slot_pool_st;
+
+/* The returned index may be one past any index issued before. */
+slot_handle_st
+slot_pool_acquire(slot_pool_st * pool);
+
+bool
+slot_pool_is_live(slot_pool_st const * pool, slot_handle_st handle);
+
+bool
+slot_pool_release(slot_pool_st * pool, slot_handle_st handle);
+
+void
+slot_pool_free(slot_pool_st * pool);
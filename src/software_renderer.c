@@ -0,0 +1,264 @@
+#include "software_renderer.h"
+
+#include <raylib.h>
+
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+struct software_renderer_st
+{
+    renderer_st renderer;
+    Image image;
+};
+
+typedef struct
+{
+    int min_x;
+    int min_y;
+    int max_x;
+    int max_y;
+} PixelBounds;
+
+static Color *
+pixels(software_renderer_st const * const software)
+{
+    return software->image.data;
+}
+
+static unsigned char
+blend_channel(unsigned char const src, unsigned char const dst, unsigned const alpha)
+{
+    return (unsigned char)((src * alpha + dst * (255 - alpha) + 127) / 255);
+}
+
+static void
+blend_pixel(Color * const dst, Color const src)
+{
+    if (src.a == 255)
+    {
+        *dst = src;
+        return;
+    }
+
+    unsigned const alpha = src.a;
+
+    dst->r = blend_channel(src.r, dst->r, alpha);
+    dst->g = blend_channel(src.g, dst->g, alpha);
+    dst->b = blend_channel(src.b, dst->b, alpha);
+    dst->a = (unsigned char)(alpha + (dst->a * (255 - alpha) + 127) / 255);
+}
+
+/* The pixels whose centres may lie within [min, max), clipped to the image. */
+static PixelBounds
+clip_bounds(
+    software_renderer_st const * const software, Vector2 const min, Vector2 const max
+)
+{
+    PixelBounds bounds = {
+        .min_x = (int)ceilf(min.x - .5f),
+        .min_y = (int)ceilf(min.y - .5f),
+        .max_x = (int)ceilf(max.x - .5f),
+        .max_y = (int)ceilf(max.y - .5f),
+    };
+
+    if (bounds.min_x < 0)
+    {
+        bounds.min_x = 0;
+    }
+    if (bounds.min_y < 0)
+    {
+        bounds.min_y = 0;
+    }
+    if (bounds.max_x > software->image.width)
+    {
+        bounds.max_x = software->image.width;
+    }
+    if (bounds.max_y > software->image.height)
+    {
+        bounds.max_y = software->image.height;
+    }
+
+    return bounds;
+}
+
+static void
+software_clear(void * const ctx, Color const color)
+{
+    software_renderer_st * const software = ctx;
+    size_t const count = (size_t)software->image.width * software->image.height;
+    Color * const dst = pixels(software);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        dst[i] = color;
+    }
+}
+
+static void
+software_rectangle(void * const ctx, Rectangle const rec, Color const color)
+{
+    software_renderer_st * const software = ctx;
+    Vector2 const min = {rec.x, rec.y};
+    Vector2 const max = {rec.x + rec.width, rec.y + rec.height};
+    PixelBounds const bounds = clip_bounds(software, min, max);
+    Color * const dst = pixels(software);
+
+    for (int y = bounds.min_y; y < bounds.max_y; y++)
+    {
+        for (int x = bounds.min_x; x < bounds.max_x; x++)
+        {
+            blend_pixel(&dst[y * software->image.width + x], color);
+        }
+    }
+}
+
+/* Twice the signed area of (a, b, p). Positive when 'p' is left of a->b. */
+static float
+edge_function(Vector2 const a, Vector2 const b, Vector2 const p)
+{
+    return (b.x - a.x) * (p.y - a.y) - (b.y - a.y) * (p.x - a.x);
+}
+
+static bool
+inside_quad(Vector2 const corners[4], Vector2 const p)
+{
+    for (size_t i = 0; i < 4; i++)
+    {
+        if (edge_function(corners[i], corners[(i + 1) % 4], p) < 0.f)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void
+fill_quad(software_renderer_st * const software, Vector2 const corners[4], Color const color)
+{
+    Vector2 min = corners[0];
+    Vector2 max = corners[0];
+
+    for (size_t i = 1; i < 4; i++)
+    {
+        min.x = fminf(min.x, corners[i].x);
+        min.y = fminf(min.y, corners[i].y);
+        max.x = fmaxf(max.x, corners[i].x);
+        max.y = fmaxf(max.y, corners[i].y);
+    }
+
+    PixelBounds const bounds = clip_bounds(software, min, max);
+    Color * const dst = pixels(software);
+
+    for (int y = bounds.min_y; y < bounds.max_y; y++)
+    {
+        for (int x = bounds.min_x; x < bounds.max_x; x++)
+        {
+            Vector2 const centre = {x + .5f, y + .5f};
+
+            if (inside_quad(corners, centre))
+            {
+                blend_pixel(&dst[y * software->image.width + x], color);
+            }
+        }
+    }
+}
+
+/* Corners are computed the same way as raylib's DrawRectanglePro(). */
+static void
+software_rectangle_pro(
+    void * const ctx,
+    Rectangle const rec,
+    Vector2 const origin,
+    float const rotation,
+    Color const color
+)
+{
+    software_renderer_st * const software = ctx;
+
+    if (rotation == 0.f)
+    {
+        Rectangle const moved = {rec.x - origin.x, rec.y - origin.y, rec.width, rec.height};
+
+        software_rectangle(software, moved, color);
+        return;
+    }
+
+    float const radians = rotation * (PI / 180.f);
+    float const sin_rotation = sinf(radians);
+    float const cos_rotation = cosf(radians);
+    float const dx = -origin.x;
+    float const dy = -origin.y;
+    /* Clockwise on screen, so every edge function is non-negative inside. */
+    Vector2 const corners[4] = {
+        {
+            rec.x + dx * cos_rotation - dy * sin_rotation,
+            rec.y + dx * sin_rotation + dy * cos_rotation,
+        },
+        {
+            rec.x + (dx + rec.width) * cos_rotation - dy * sin_rotation,
+            rec.y + (dx + rec.width) * sin_rotation + dy * cos_rotation,
+        },
+        {
+            rec.x + (dx + rec.width) * cos_rotation - (dy + rec.height) * sin_rotation,
+            rec.y + (dx + rec.width) * sin_rotation + (dy + rec.height) * cos_rotation,
+        },
+        {
+            rec.x + dx * cos_rotation - (dy + rec.height) * sin_rotation,
+            rec.y + dx * sin_rotation + (dy + rec.height) * cos_rotation,
+        },
+    };
+
+    fill_quad(software, corners, color);
+}
+
+static renderer_handlers_st const
+software_renderer_handlers = {
+    .clear = software_clear,
+    .rectangle = software_rectangle,
+    .rectangle_pro = software_rectangle_pro,
+};
+
+software_renderer_st *
+software_renderer_new(int const width, int const height)
+{
+    software_renderer_st * const software = calloc(1, sizeof(*software));
+    assert(software != NULL);
+
+    software->image = GenImageColor(width, height, BLANK);
+    assert(software->image.data != NULL);
+    assert(software->image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    software->renderer = (renderer_st){
+        .handlers = &software_renderer_handlers,
+        .ctx = software,
+    };
+
+    return software;
+}
+
+void
+software_renderer_free(software_renderer_st * const software)
+{
+    if (software == NULL)
+    {
+        return;
+    }
+    UnloadImage(software->image);
+    free(software);
+}
+
+renderer_st const *
+software_renderer_renderer(software_renderer_st const * const software)
+{
+    return &software->renderer;
+}
+
+Image
+software_renderer_image(software_renderer_st const * const software)
+{
+    return software->image;
+}
+
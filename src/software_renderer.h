@@ -0,0 +1,27 @@
+#pragma once
+
+#include "renderer.h"
+
+#include <raylib.h>
+
+/*
+ * A CPU rasterizer for the renderer primitives. It needs no window or GPU,
+ * so frames can be rendered and checked headless. A pixel is covered when
+ * its centre lies inside a shape; there is no anti-aliasing.
+ */
+
+typedef struct software_renderer_st software_renderer_st;
+
+software_renderer_st *
+software_renderer_new(int width, int height);
+
+void
+software_renderer_free(software_renderer_st * software);
+
+renderer_st const *
+software_renderer_renderer(software_renderer_st const * software);
+
+/* The pixels drawn so far, in R8G8B8A8 format. Owned by the renderer. */
+Image
+software_renderer_image(software_renderer_st const * software);
+
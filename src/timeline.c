@@ -0,0 +1,496 @@
+#include "timeline.h"
+
+#include "dynamic_array.h"
+
+#include <assert.h>
+#include <stdlib.h>
+
+typedef enum
+{
+    TIMELINE_NODE_TWEEN,
+    TIMELINE_NODE_DELAY,
+    TIMELINE_NODE_SEQUENCE,
+    TIMELINE_NODE_PARALLEL,
+    TIMELINE_NODE_REPEAT,
+} timeline_node_type;
+
+typedef struct
+{
+    size_t property;
+    float from;
+    float to;
+    timeline_easing_fn easing;
+} tween_node_st;
+
+typedef struct
+{
+    size_t first_child;
+    size_t count;
+    float offset;
+} group_node_st;
+
+typedef struct
+{
+    size_t child;
+    size_t count;
+    bool yoyo;
+} repeat_node_st;
+
+typedef struct
+{
+    timeline_node_type type;
+    float duration;
+    tween_node_st tween;
+    group_node_st group;
+    repeat_node_st repeat;
+} builder_node_st;
+
+typedef struct
+{
+    builder_node_st * items;
+    size_t count;
+    size_t capacity;
+} builder_nodes_st;
+
+typedef struct
+{
+    size_t * items;
+    size_t count;
+    size_t capacity;
+} node_indexes_st;
+
+struct timeline_builder_st
+{
+    builder_nodes_st nodes;
+    node_indexes_st children;
+};
+
+typedef struct
+{
+    float start;
+    float inverse_duration;
+    float from;
+    float delta;
+    timeline_easing_fn easing;
+    size_t property;
+    size_t order;
+    bool reversed;
+} track_st;
+
+typedef struct
+{
+    track_st * items;
+    size_t count;
+    size_t capacity;
+} tracks_st;
+
+/* The tracks for one property: tracks[first, end). */
+typedef struct
+{
+    size_t first;
+    size_t end;
+} track_range_st;
+
+typedef struct
+{
+    track_range_st * items;
+    size_t count;
+    size_t capacity;
+} track_ranges_st;
+
+struct timeline_st
+{
+    tracks_st tracks;
+    track_ranges_st properties;
+    float duration;
+};
+
+static timeline_node_st
+add_node(timeline_builder_st * const builder, builder_node_st const node)
+{
+    da_append(&builder->nodes, node);
+
+    return (timeline_node_st){.index = builder->nodes.count - 1};
+}
+
+static builder_node_st const *
+get_node(timeline_builder_st const * const builder, size_t const index)
+{
+    assert(index < builder->nodes.count);
+
+    return &builder->nodes.items[index];
+}
+
+timeline_builder_st *
+timeline_builder_new(void)
+{
+    timeline_builder_st * const builder = calloc(1, sizeof(*builder));
+    assert(builder != NULL);
+
+    return builder;
+}
+
+void
+timeline_builder_free(timeline_builder_st * const builder)
+{
+    if (builder == NULL)
+    {
+        return;
+    }
+    da_free(builder->nodes);
+    da_free(builder->children);
+    free(builder);
+}
+
+timeline_node_st
+timeline_tween(
+    timeline_builder_st * const builder,
+    size_t const property,
+    float const from,
+    float const to,
+    float const duration,
+    timeline_easing_fn const easing
+)
+{
+    builder_node_st const node = {
+        .type = TIMELINE_NODE_TWEEN,
+        .duration = duration,
+        .tween = {.property = property, .from = from, .to = to, .easing = easing},
+    };
+
+    return add_node(builder, node);
+}
+
+timeline_node_st
+timeline_delay(timeline_builder_st * const builder, float const duration)
+{
+    builder_node_st const node = {.type = TIMELINE_NODE_DELAY, .duration = duration};
+
+    return add_node(builder, node);
+}
+
+static timeline_node_st
+add_group(
+    timeline_builder_st * const builder,
+    timeline_node_type const type,
+    timeline_node_st const * const children,
+    size_t const count,
+    float const offset
+)
+{
+    builder_node_st node = {
+        .type = type,
+        .group = {.first_child = builder->children.count, .count = count, .offset = offset},
+    };
+
+    for (size_t i = 0; i < count; i++)
+    {
+        float const child_duration = get_node(builder, children[i].index)->duration;
+
+        if (type == TIMELINE_NODE_SEQUENCE)
+        {
+            node.duration += child_duration;
+        }
+        else
+        {
+            float const child_end = i * offset + child_duration;
+
+            if (child_end > node.duration)
+            {
+                node.duration = child_end;
+            }
+        }
+        da_append(&builder->children, children[i].index);
+    }
+
+    return add_node(builder, node);
+}
+
+timeline_node_st
+timeline_sequence(
+    timeline_builder_st * const builder, timeline_node_st const * const children, size_t const count
+)
+{
+    return add_group(builder, TIMELINE_NODE_SEQUENCE, children, count, 0.f);
+}
+
+timeline_node_st
+timeline_parallel(
+    timeline_builder_st * const builder, timeline_node_st const * const children, size_t const count
+)
+{
+    return add_group(builder, TIMELINE_NODE_PARALLEL, children, count, 0.f);
+}
+
+timeline_node_st
+timeline_stagger(
+    timeline_builder_st * const builder,
+    timeline_node_st const * const children,
+    size_t const count,
+    float const offset
+)
+{
+    return add_group(builder, TIMELINE_NODE_PARALLEL, children, count, offset);
+}
+
+timeline_node_st
+timeline_repeat(
+    timeline_builder_st * const builder,
+    timeline_node_st const child,
+    size_t const count,
+    bool const yoyo
+)
+{
+    builder_node_st const node = {
+        .type = TIMELINE_NODE_REPEAT,
+        .duration = get_node(builder, child.index)->duration * count,
+        .repeat = {.child = child.index, .count = count, .yoyo = yoyo},
+    };
+
+    return add_node(builder, node);
+}
+
+/*
+ * Place a child that starts 'local_offset' seconds into its parent. When the
+ * parent is running backwards the child is mirrored within the parent's span.
+ */
+static float
+child_start(
+    float const parent_start,
+    float const parent_duration,
+    float const local_offset,
+    float const child_duration,
+    bool const reversed
+)
+{
+    if (reversed)
+    {
+        return parent_start + parent_duration - local_offset - child_duration;
+    }
+
+    return parent_start + local_offset;
+}
+
+static void
+emit_track(
+    tracks_st * const tracks,
+    builder_node_st const * const node,
+    float const start,
+    bool const reversed
+)
+{
+    tween_node_st const * const tween = &node->tween;
+    track_st const track = {
+        .start = start,
+        .inverse_duration = node->duration > 0.f ? 1.f / node->duration : 0.f,
+        .from = tween->from,
+        .delta = tween->to - tween->from,
+        .easing = tween->easing,
+        .property = tween->property,
+        .order = tracks->count,
+        .reversed = reversed,
+    };
+
+    da_append(tracks, track);
+}
+
+static void
+compile_node(
+    timeline_builder_st const * const builder,
+    size_t const index,
+    float const start,
+    bool const reversed,
+    tracks_st * const tracks
+)
+{
+    builder_node_st const * const node = get_node(builder, index);
+
+    switch (node->type)
+    {
+    case TIMELINE_NODE_TWEEN:
+        emit_track(tracks, node, start, reversed);
+        break;
+
+    case TIMELINE_NODE_DELAY:
+        break;
+
+    case TIMELINE_NODE_SEQUENCE:
+    case TIMELINE_NODE_PARALLEL:
+    {
+        float local_offset = 0.f;
+
+        for (size_t i = 0; i < node->group.count; i++)
+        {
+            size_t const child = builder->children.items[node->group.first_child + i];
+            float const child_duration = get_node(builder, child)->duration;
+
+            if (node->type == TIMELINE_NODE_PARALLEL)
+            {
+                local_offset = i * node->group.offset;
+            }
+            float const begin =
+                child_start(start, node->duration, local_offset, child_duration, reversed);
+
+            compile_node(builder, child, begin, reversed, tracks);
+            if (node->type == TIMELINE_NODE_SEQUENCE)
+            {
+                local_offset += child_duration;
+            }
+        }
+        break;
+    }
+
+    case TIMELINE_NODE_REPEAT:
+    {
+        float const child_duration = get_node(builder, node->repeat.child)->duration;
+
+        for (size_t i = 0; i < node->repeat.count; i++)
+        {
+            bool const backwards = node->repeat.yoyo && (i % 2) == 1;
+            float const begin =
+                child_start(start, node->duration, i * child_duration, child_duration, reversed);
+
+            compile_node(builder, node->repeat.child, begin, reversed != backwards, tracks);
+        }
+        break;
+    }
+    }
+}
+
+static int
+compare_tracks(void const * const pa, void const * const pb)
+{
+    track_st const * const a = pa;
+    track_st const * const b = pb;
+
+    if (a->property != b->property)
+    {
+        return a->property < b->property ? -1 : 1;
+    }
+    if (a->start != b->start)
+    {
+        return a->start < b->start ? -1 : 1;
+    }
+
+    if (a->order != b->order)
+    {
+        return a->order < b->order ? -1 : 1;
+    }
+
+    return 0;
+}
+
+timeline_st *
+timeline_compile(timeline_builder_st const * const builder, timeline_node_st const root)
+{
+    timeline_st * const timeline = calloc(1, sizeof(*timeline));
+    assert(timeline != NULL);
+
+    timeline->duration = get_node(builder, root.index)->duration;
+    compile_node(builder, root.index, 0.f, false, &timeline->tracks);
+
+    tracks_st * const tracks = &timeline->tracks;
+
+    if (tracks->count > 0)
+    {
+        qsort(tracks->items, tracks->count, sizeof(*tracks->items), compare_tracks);
+    }
+    for (size_t i = 0; i < tracks->count; i++)
+    {
+        if (i == 0 || tracks->items[i - 1].property != tracks->items[i].property)
+        {
+            da_append(&timeline->properties, ((track_range_st){.first = i, .end = i}));
+        }
+        da_last(&timeline->properties).end = i + 1;
+    }
+
+    return timeline;
+}
+
+void
+timeline_free(timeline_st * const timeline)
+{
+    if (timeline == NULL)
+    {
+        return;
+    }
+    da_free(timeline->tracks);
+    da_free(timeline->properties);
+    free(timeline);
+}
+
+float
+timeline_duration(timeline_st const * const timeline)
+{
+    return timeline->duration;
+}
+
+static float
+track_fraction(track_st const * const track, float const elapsed)
+{
+    if (track->inverse_duration == 0.f)
+    {
+        return elapsed >= 0.f ? 1.f : 0.f;
+    }
+
+    float const fraction = elapsed * track->inverse_duration;
+
+    if (fraction < 0.f)
+    {
+        return 0.f;
+    }
+    if (fraction > 1.f)
+    {
+        return 1.f;
+    }
+
+    return fraction;
+}
+
+/*
+ * Tracks within a range are sorted by start time, so the last track that has
+ * started determines the value. The first track also supplies the value
+ * before anything has started.
+ */
+static track_st const *
+deciding_track(tracks_st const * const tracks, track_range_st const * const range, float const time)
+{
+    size_t low = range->first;
+    size_t high = range->end - 1;
+
+    while (low < high)
+    {
+        size_t const mid = low + (high - low + 1) / 2;
+
+        if (tracks->items[mid].start <= time)
+        {
+            low = mid;
+        }
+        else
+        {
+            high = mid - 1;
+        }
+    }
+
+    return &tracks->items[low];
+}
+
+void
+timeline_evaluate(timeline_st const * const timeline, float const time, float * const values)
+{
+    for (size_t i = 0; i < timeline->properties.count; i++)
+    {
+        track_st const * const track =
+            deciding_track(&timeline->tracks, &timeline->properties.items[i], time);
+        float fraction = track_fraction(track, time - track->start);
+
+        if (track->reversed)
+        {
+            fraction = 1.f - fraction;
+        }
+
+        float const eased = track->easing != NULL ? track->easing(fraction) : fraction;
+
+        values[track->property] = track->from + track->delta * eased;
+    }
+}
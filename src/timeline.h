@@ -0,0 +1,82 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+ * Composable animation timelines.
+ *
+ * A timeline is described as a tree of nodes (tweens, delays, sequences,
+ * parallel groups, staggered groups and repeats) using a builder, then
+ * compiled into a flat list of tracks grouped by property. Evaluating a
+ * compiled timeline looks up the one track that decides each property and
+ * eases only that, so neither the depth of the composition nor the number of
+ * repeats costs anything per frame, and no memory is allocated after
+ * compilation.
+ */
+
+typedef float
+(*timeline_easing_fn)(float fraction);
+
+typedef struct timeline_builder_st timeline_builder_st;
+typedef struct timeline_st timeline_st;
+
+typedef struct
+{
+    size_t index;
+} timeline_node_st;
+
+timeline_builder_st *
+timeline_builder_new(void);
+
+void
+timeline_builder_free(timeline_builder_st * builder);
+
+/*
+ * Animate the value at index 'property' from 'from' to 'to'. A NULL easing
+ * function gives linear interpolation.
+ */
+timeline_node_st
+timeline_tween(
+    timeline_builder_st * builder,
+    size_t property,
+    float from,
+    float to,
+    float duration,
+    timeline_easing_fn easing
+);
+
+timeline_node_st
+timeline_delay(timeline_builder_st * builder, float duration);
+
+timeline_node_st
+timeline_sequence(timeline_builder_st * builder, timeline_node_st const * children, size_t count);
+
+timeline_node_st
+timeline_parallel(timeline_builder_st * builder, timeline_node_st const * children, size_t count);
+
+/* Like timeline_parallel(), but child 'i' starts 'i * offset' seconds late. */
+timeline_node_st
+timeline_stagger(
+    timeline_builder_st * builder, timeline_node_st const * children, size_t count, float offset
+);
+
+/* Play 'child' 'count' times. With 'yoyo' set every second pass runs backwards. */
+timeline_node_st
+timeline_repeat(timeline_builder_st * builder, timeline_node_st child, size_t count, bool yoyo);
+
+timeline_st *
+timeline_compile(timeline_builder_st const * builder, timeline_node_st root);
+
+void
+timeline_free(timeline_st * timeline);
+
+float
+timeline_duration(timeline_st const * timeline);
+
+/*
+ * Write the value of every animated property at 'time' into 'values'.
+ * Properties that are not animated by the timeline are left untouched.
+ */
+void
+timeline_evaluate(timeline_st const * timeline, float time, float * values);
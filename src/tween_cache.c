@@ -0,0 +1,221 @@
+#include "tween_cache.h"
+
+#include "dynamic_array.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct
+{
+    /* Entries from earlier frames are free. */
+    uint32_t frame;
+    tween_easing_fn easing;
+    double start;
+    float duration;
+    TweenSample sample;
+} tween_entry_st;
+
+typedef struct
+{
+    tween_entry_st * items;
+    size_t count;
+    size_t capacity;
+} tween_entries_st;
+
+struct tween_cache_st
+{
+    /* The entry count is always a power of two. */
+    tween_entries_st entries;
+    size_t used;
+    uint32_t frame;
+    double now;
+    tween_cache_stats_st stats;
+};
+
+static size_t const initial_entries = 64;
+
+tween_cache_st *
+tween_cache_new(void)
+{
+    tween_cache_st * const cache = calloc(1, sizeof(*cache));
+    assert(cache != NULL);
+
+    da_resize(&cache->entries, initial_entries);
+    memset(cache->entries.items, 0, initial_entries * sizeof(*cache->entries.items));
+    cache->frame = 1;
+
+    return cache;
+}
+
+void
+tween_cache_free(tween_cache_st * const cache)
+{
+    if (cache == NULL)
+    {
+        return;
+    }
+    da_free(cache->entries);
+    free(cache);
+}
+
+void
+tween_cache_begin_frame(tween_cache_st * const cache, double const now)
+{
+    cache->frame++;
+    cache->used = 0;
+    cache->now = now;
+}
+
+tween_st
+tween_cache_tween(tween_easing_fn const easing, double const start, float const duration)
+{
+    return (tween_st){.easing = easing, .start = start, .duration = duration, .slot = SIZE_MAX};
+}
+
+static uint32_t
+float_bits(float const value)
+{
+    uint32_t bits;
+
+    memcpy(&bits, &value, sizeof(bits));
+
+    return bits;
+}
+
+static uint64_t
+double_bits(double const value)
+{
+    uint64_t bits;
+
+    memcpy(&bits, &value, sizeof(bits));
+
+    return bits;
+}
+
+static size_t
+hash_tween(tween_st const * const tween)
+{
+    uint64_t hash = (uint64_t)(uintptr_t)tween->easing;
+
+    hash = (hash ^ double_bits(tween->start)) * 0x100000001b3ULL;
+    hash = (hash ^ float_bits(tween->duration)) * 0x100000001b3ULL;
+
+    return (size_t)(hash ^ (hash >> 29));
+}
+
+static bool
+entry_matches(tween_cache_st const * const cache, size_t const slot, tween_st const * const tween)
+{
+    tween_entry_st const * const entry = &cache->entries.items[slot];
+
+    return entry->frame == cache->frame
+           && entry->easing == tween->easing
+           && entry->start == tween->start
+           && entry->duration == tween->duration;
+}
+
+static TweenSample
+evaluate(tween_cache_st * const cache, tween_st const * const tween)
+{
+    float fraction = 1.f;
+
+    if (tween->duration > 0.f)
+    {
+        fraction = (float)((cache->now - tween->start) / tween->duration);
+    }
+    if (fraction > 1.f)
+    {
+        fraction = 1.f;
+    }
+    if (fraction < 0.f)
+    {
+        fraction = 0.f;
+    }
+    cache->stats.evaluations++;
+
+    return (TweenSample){.fraction = fraction, .eased = tween->easing(fraction)};
+}
+
+/* Find the slot for 'tween' in this frame's entries, claiming a free one if needed. */
+static size_t
+probe(tween_cache_st const * const cache, tween_st const * const tween)
+{
+    size_t const mask = cache->entries.count - 1;
+    size_t slot = hash_tween(tween) & mask;
+
+    while (cache->entries.items[slot].frame == cache->frame && !entry_matches(cache, slot, tween))
+    {
+        slot = (slot + 1) & mask;
+    }
+
+    return slot;
+}
+
+static void
+grow(tween_cache_st * const cache)
+{
+    tween_entries_st const old = cache->entries;
+    size_t const count = old.count * 2;
+
+    cache->entries = (tween_entries_st){0};
+    da_resize(&cache->entries, count);
+    memset(cache->entries.items, 0, count * sizeof(*cache->entries.items));
+
+    for (size_t i = 0; i < old.count; i++)
+    {
+        tween_entry_st const * const entry = &old.items[i];
+
+        if (entry->frame != cache->frame)
+        {
+            continue;
+        }
+
+        tween_st const key = tween_cache_tween(entry->easing, entry->start, entry->duration);
+
+        cache->entries.items[probe(cache, &key)] = *entry;
+    }
+    da_free(old);
+}
+
+TweenSample
+tween_cache_sample(tween_cache_st * const cache, tween_st * const tween)
+{
+    cache->stats.samples++;
+
+    if (tween->slot < cache->entries.count && entry_matches(cache, tween->slot, tween))
+    {
+        return cache->entries.items[tween->slot].sample;
+    }
+
+    size_t slot = probe(cache, tween);
+
+    if (cache->entries.items[slot].frame != cache->frame)
+    {
+        if ((cache->used + 1) * 2 > cache->entries.count)
+        {
+            grow(cache);
+            slot = probe(cache, tween);
+        }
+        cache->entries.items[slot] = (tween_entry_st){
+            .frame = cache->frame,
+            .easing = tween->easing,
+            .start = tween->start,
+            .duration = tween->duration,
+            .sample = evaluate(cache, tween),
+        };
+        cache->used++;
+    }
+    tween->slot = slot;
+
+    return cache->entries.items[slot].sample;
+}
+
+tween_cache_stats_st
+tween_cache_stats(tween_cache_st const * const cache)
+{
+    return cache->stats;
+}
+
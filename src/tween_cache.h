@@ -0,0 +1,63 @@
+#pragma once
+
+#include <stddef.h>
+
+/*
+ * Shares eased fractions between tweens that use the same easing function,
+ * start time and duration. The first tween of such a group to be sampled in
+ * a frame evaluates the easing function; the rest of the group reuse the
+ * result. Each tween remembers where its group was found, so a repeat
+ * lookup in the same frame is a key comparison rather than a hash probe.
+ *
+ * No scene samples through the cache yet. bench_tween_cache compares it
+ * with calling the easing function directly; it belongs on a hot path only
+ * once that shows a saving for the easing functions in use.
+ */
+
+typedef float
+(*tween_easing_fn)(float fraction);
+
+typedef struct tween_cache_st tween_cache_st;
+
+typedef struct
+{
+    tween_easing_fn easing;
+    /* Module clock time, which is a double so that it keeps its precision over long runs. */
+    double start;
+    float duration;
+    /* Where the group was last found. Revalidated on every sample. */
+    size_t slot;
+} tween_st;
+
+typedef struct
+{
+    float fraction;
+    float eased;
+} TweenSample;
+
+typedef struct
+{
+    size_t samples;
+    size_t evaluations;
+} tween_cache_stats_st;
+
+tween_cache_st *
+tween_cache_new(void);
+
+void
+tween_cache_free(tween_cache_st * cache);
+
+/* Discard the previous frame's samples. 'now' is the time that tweens are sampled at. */
+void
+tween_cache_begin_frame(tween_cache_st * cache, double now);
+
+tween_st
+tween_cache_tween(tween_easing_fn easing, double start, float duration);
+
+TweenSample
+tween_cache_sample(tween_cache_st * cache, tween_st * tween);
+
+/* Totals since the cache was created. */
+tween_cache_stats_st
+tween_cache_stats(tween_cache_st const * cache);
+
@@ -0,0 +1,92 @@
+#include "wake_queue.h"
+
+#include "dynamic_array.h"
+
+static void
+swap_entries(wake_queue_st * const queue, size_t const a, size_t const b)
+{
+    wake_entry_st const entry = queue->items[a];
+
+    queue->items[a] = queue->items[b];
+    queue->items[b] = entry;
+}
+
+static void
+sift_up(wake_queue_st * const queue, size_t index)
+{
+    while (index > 0)
+    {
+        size_t const parent = (index - 1) / 2;
+
+        if (queue->items[parent].wake_time <= queue->items[index].wake_time)
+        {
+            break;
+        }
+        swap_entries(queue, parent, index);
+        index = parent;
+    }
+}
+
+static void
+sift_down(wake_queue_st * const queue, size_t index)
+{
+    for (;;)
+    {
+        size_t const left = index * 2 + 1;
+        size_t const right = left + 1;
+        size_t earliest = index;
+
+        if (left < queue->count && queue->items[left].wake_time < queue->items[earliest].wake_time)
+        {
+            earliest = left;
+        }
+        if (right < queue->count && queue->items[right].wake_time < queue->items[earliest].wake_time)
+        {
+            earliest = right;
+        }
+        if (earliest == index)
+        {
+            break;
+        }
+        swap_entries(queue, earliest, index);
+        index = earliest;
+    }
+}
+
+void
+wake_queue_push(wake_queue_st * const queue, double const wake_time, slot_handle_st const handle)
+{
+    wake_entry_st const entry = {.wake_time = wake_time, .handle = handle};
+
+    da_append(queue, entry);
+    sift_up(queue, queue->count - 1);
+}
+
+bool
+wake_queue_pop_due(wake_queue_st * const queue, double const now, slot_handle_st * const handle)
+{
+    if (queue->count == 0 || queue->items[0].wake_time > now)
+    {
+        return false;
+    }
+
+    *handle = queue->items[0].handle;
+    queue->items[0] = queue->items[--queue->count];
+    sift_down(queue, 0);
+
+    return true;
+}
+
+void
+wake_queue_clear(wake_queue_st * const queue)
+{
+    queue->count = 0;
+}
+
+void
+wake_queue_free(wake_queue_st * const queue)
+{
+    da_free(*queue);
+    *queue = (wake_queue_st){0};
+}
+
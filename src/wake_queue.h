@@ -0,0 +1,34 @@
+#pragma once
+
+#include "slot_pool.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/* A min-heap of sleeping objects ordered by the time they are due to wake. */
+
+typedef struct
+{
+    double wake_time;
+    slot_handle_st handle;
+} wake_entry_st;
+
+typedef struct wake_queue_st {
+    wake_entry_st * items;
+    size_t count;
+    size_t capacity;
+} wake_queue_st;
+
+void
+wake_queue_push(wake_queue_st * queue, double wake_time, slot_handle_st handle);
+
+/* Remove the earliest entry if it is due at or before 'now'. */
+bool
+wake_queue_pop_due(wake_queue_st * queue, double now, slot_handle_st * handle);
+
+void
+wake_queue_clear(wake_queue_st * queue);
+
+void
+wake_queue_free(wake_queue_st * queue);
+
@@ -0,0 +1,214 @@
+/*
+ * Checks that incremental flow layout updates give the same result as laying
+ * everything out from scratch.
+ */
+#include "flow_layout.h"
+
+#include <raylib.h>
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static size_t failures;
+
+#define CHECK(condition, ...) \
+    do \
+    { \
+        if (!(condition)) \
+        { \
+            printf("%s:%d: ", __FILE__, __LINE__); \
+            printf(__VA_ARGS__); \
+            printf("\n"); \
+            failures++; \
+        } \
+    } while (0)
+
+static flow_layout_config_st const config = {
+    .pad = 10.f,
+    .min_row_height = 20.f,
+};
+
+static bool
+same_rect(Rectangle const a, Rectangle const b)
+{
+    return a.x == b.x && a.y == b.y && a.width == b.width && a.height == b.height;
+}
+
+static void
+check_against_scratch(
+    flow_layout_st const * const layout,
+    Vector2 const * const sizes,
+    size_t const count,
+    float const width,
+    char const * const step
+)
+{
+    flow_layout_st * const scratch = flow_layout_new(&config, width);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        flow_layout_add_item(scratch, sizes[i]);
+    }
+    flow_layout_update(scratch);
+
+    CHECK(
+        flow_layout_row_count(layout) == flow_layout_row_count(scratch),
+        "%s: %zu rows, expected %zu",
+        step,
+        flow_layout_row_count(layout),
+        flow_layout_row_count(scratch)
+    );
+    for (size_t i = 0; i < count; i++)
+    {
+        Rectangle const actual = flow_layout_item_rect(layout, i);
+        Rectangle const expected = flow_layout_item_rect(scratch, i);
+
+        if (!same_rect(actual, expected))
+        {
+            CHECK(
+                false,
+                "%s: item %zu at (%g, %g), expected (%g, %g)",
+                step,
+                i,
+                actual.x,
+                actual.y,
+                expected.x,
+                expected.y
+            );
+            break;
+        }
+    }
+
+    flow_layout_free(scratch);
+}
+
+static void
+test_first_item_moves_up_a_row(void)
+{
+    Vector2 sizes[] = {{40.f, 40.f}, {40.f, 40.f}};
+    flow_layout_st * const layout = flow_layout_new(&config, 100.f);
+
+    flow_layout_add_item(layout, sizes[0]);
+    flow_layout_add_item(layout, sizes[1]);
+    flow_layout_update(layout);
+    CHECK(flow_layout_row_count(layout) == 2, "expected 2 rows before shrinking");
+
+    sizes[1] = (Vector2){20.f, 20.f};
+    flow_layout_set_item_size(layout, 1, sizes[1]);
+    flow_layout_update(layout);
+
+    Rectangle const moved = flow_layout_item_rect(layout, 1);
+
+    CHECK(flow_layout_row_count(layout) == 1, "expected 1 row after shrinking");
+    CHECK(moved.x == 60.f && moved.y == 10.f, "item 1 at (%g, %g)", moved.x, moved.y);
+    check_against_scratch(layout, sizes, 2, 100.f, "shrink");
+
+    flow_layout_free(layout);
+}
+
+static float
+random_between(int const low, int const high)
+{
+    return (float)(low + rand() % (high - low + 1));
+}
+
+static void
+test_random_updates(void)
+{
+    size_t const max_items = 300;
+    size_t const steps = 2000;
+    Vector2 * const sizes = calloc(max_items, sizeof(*sizes));
+    Rectangle * const before = calloc(max_items, sizeof(*before));
+    float width = 400.f;
+    size_t count = 0;
+    flow_layout_st * const layout = flow_layout_new(&config, width);
+
+    srand(1);
+    for (size_t step = 0; step < steps; step++)
+    {
+        char description[64];
+        int const action = rand() % 10;
+        size_t const previous_count = count;
+
+        for (size_t i = 0; i < count; i++)
+        {
+            before[i] = flow_layout_item_rect(layout, i);
+        }
+
+        if ((action < 3 || count == 0) && count < max_items)
+        {
+            sizes[count] = (Vector2){random_between(5, 120), random_between(5, 60)};
+            flow_layout_add_item(layout, sizes[count]);
+            count++;
+            snprintf(description, sizeof(description), "step %zu add", step);
+        }
+        else if (action < 9)
+        {
+            /* Change a few sizes at once, so the first dirty item is not always the last. */
+            size_t const changes = 1 + rand() % 3;
+
+            for (size_t i = 0; i < changes; i++)
+            {
+                size_t const index = rand() % count;
+
+                sizes[index] = (Vector2){random_between(5, 120), random_between(5, 60)};
+                flow_layout_set_item_size(layout, index, sizes[index]);
+            }
+            snprintf(description, sizeof(description), "step %zu resize items", step);
+        }
+        else
+        {
+            width = random_between(150, 800);
+            flow_layout_set_width(layout, width);
+            snprintf(description, sizeof(description), "step %zu set width", step);
+        }
+
+        size_t const first_moved = flow_layout_update(layout);
+
+        check_against_scratch(layout, sizes, count, width, description);
+
+        /* Items before the reported one must not have moved. */
+        for (size_t i = 0; i < first_moved && i < previous_count; i++)
+        {
+            Rectangle const after = flow_layout_item_rect(layout, i);
+
+            if (before[i].x != after.x || before[i].y != after.y)
+            {
+                CHECK(
+                    false,
+                    "%s: item %zu moved but the first moved item was reported as %zu",
+                    description,
+                    i,
+                    first_moved
+                );
+                break;
+            }
+        }
+        if (failures > 0)
+        {
+            break;
+        }
+    }
+
+    flow_layout_free(layout);
+    free(before);
+    free(sizes);
+}
+
+int
+main(void)
+{
+    test_first_item_moves_up_a_row();
+    test_random_updates();
+
+    if (failures > 0)
+    {
+        printf("%zu failure(s)\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("flow layout: all checks passed\n");
+
+    return EXIT_SUCCESS;
+}
+
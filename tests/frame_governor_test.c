@@ -0,0 +1,200 @@
+/*
+ * Feeds synthetic frame timings to the frame governor and checks the level
+ * changes and counters that result.
+ */
+#include "frame_governor.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static size_t failures;
+
+#define CHECK(condition, ...) \
+    do \
+    { \
+        if (!(condition)) \
+        { \
+            printf("%s:%d: ", __FILE__, __LINE__); \
+            printf(__VA_ARGS__); \
+            printf("\n"); \
+            failures++; \
+        } \
+    } while (0)
+
+static frame_governor_config_st const config = {
+    .budget = 0.010f,
+    .restore_ratio = 0.5f,
+    .frames_to_degrade = 3,
+    .frames_to_restore = 5,
+};
+
+/* Work split evenly between update and draw. */
+static void
+run_frames(frame_governor_st * const governor, size_t const frames, float const work)
+{
+    FrameTimings const timings = {.update = work / 2.f, .draw = work / 2.f};
+
+    for (size_t i = 0; i < frames; i++)
+    {
+        frame_governor_end_frame(governor, timings);
+    }
+}
+
+static void
+test_degrade_and_restore(void)
+{
+    frame_governor_st governor;
+
+    frame_governor_init(&governor, &config);
+
+    /* A single slow frame is not enough. */
+    run_frames(&governor, 20, 0.001f);
+    run_frames(&governor, 1, 0.050f);
+    run_frames(&governor, 20, 0.001f);
+    CHECK(governor.level == 0, "level %zu after one slow frame", governor.level);
+    CHECK(governor.counters.degrades == 0, "%zu degrades", governor.counters.degrades);
+
+    frame_governor_init(&governor, &config);
+    run_frames(&governor, config.frames_to_degrade - 1, 0.050f);
+    CHECK(governor.level == 0, "degraded after %zu frames", config.frames_to_degrade - 1);
+    run_frames(&governor, 1, 0.050f);
+    CHECK(governor.level == 1, "level %zu, expected 1", governor.level);
+    CHECK(governor.counters.degrades == 1, "%zu degrades", governor.counters.degrades);
+    CHECK(
+        governor.counters.frames_over_budget == config.frames_to_degrade,
+        "%zu frames over budget",
+        governor.counters.frames_over_budget
+    );
+
+    /*
+     * The lower level brings the work within budget but leaves no headroom.
+     * The slow frames at the old level must not cause a second degrade.
+     */
+    run_frames(&governor, 50, 0.008f);
+    CHECK(governor.level == 1, "level %zu, expected 1", governor.level);
+    CHECK(governor.counters.degrades == 1, "%zu degrades", governor.counters.degrades);
+    CHECK(governor.counters.restores == 0, "%zu restores", governor.counters.restores);
+
+    /* Plenty of headroom restores full quality, but only once it has lasted. */
+    size_t frames_to_restore = 0;
+
+    while (governor.level > 0 && frames_to_restore < 100)
+    {
+        run_frames(&governor, 1, 0.001f);
+        frames_to_restore++;
+    }
+    CHECK(governor.level == 0, "level %zu, expected 0", governor.level);
+    CHECK(
+        frames_to_restore >= config.frames_to_restore,
+        "restored after %zu frames",
+        frames_to_restore
+    );
+    CHECK(governor.counters.restores == 1, "%zu restores", governor.counters.restores);
+
+    /* Full quality is the top level. */
+    run_frames(&governor, 50, 0.001f);
+    CHECK(governor.level == 0, "level %zu, expected 0", governor.level);
+    CHECK(governor.counters.restores == 1, "%zu restores", governor.counters.restores);
+    CHECK(
+        governor.counters.frames == config.frames_to_degrade + 50 + frames_to_restore + 50,
+        "%zu frames",
+        governor.counters.frames
+    );
+}
+
+static void
+test_degrades_stop_at_the_cheapest_level(void)
+{
+    frame_governor_st governor;
+
+    frame_governor_init(&governor, &config);
+    run_frames(&governor, 1000, 0.100f);
+
+    FrameQuality const quality = frame_governor_quality(&governor);
+
+    CHECK(quality.level == governor.counters.degrades, "level %zu", quality.level);
+    CHECK(!quality.optional_effects, "optional effects at the cheapest level");
+    CHECK(quality.draw_fraction < 1.f, "draw fraction %g", quality.draw_fraction);
+    CHECK(
+        quality.low_priority_update_interval > 1,
+        "interval %zu",
+        quality.low_priority_update_interval
+    );
+
+    size_t const degrades = governor.counters.degrades;
+
+    run_frames(&governor, 100, 0.100f);
+    CHECK(governor.counters.degrades == degrades, "degraded past the cheapest level");
+}
+
+static void
+test_pacer_skips_and_carries_time(void)
+{
+    frame_governor_st governor;
+    frame_pacer_st pacer = {0};
+    DeltaTime const delta = {0.01f};
+
+    frame_governor_init(&governor, &config);
+
+    /* Every update runs at full quality. */
+    for (size_t i = 0; i < 10; i++)
+    {
+        PacedUpdate const update = frame_pacer_tick(&pacer, &governor, delta);
+
+        CHECK(update.run, "update %zu skipped at full quality", i);
+    }
+    CHECK(governor.counters.skipped_updates == 0, "%zu skipped", governor.counters.skipped_updates);
+
+    /* Degrade until low priority updates are skipped. */
+    while (frame_governor_quality(&governor).low_priority_update_interval == 1)
+    {
+        run_frames(&governor, 1, 0.050f);
+    }
+
+    size_t const interval = frame_governor_quality(&governor).low_priority_update_interval;
+    size_t const updates = 3;
+    size_t runs = 0;
+
+    for (size_t i = 0; i < updates * interval; i++)
+    {
+        PacedUpdate const update = frame_pacer_tick(&pacer, &governor, delta);
+
+        if (update.run)
+        {
+            float const expected = delta.value * interval;
+
+            CHECK(
+                update.delta.value > expected - 1e-6f && update.delta.value < expected + 1e-6f,
+                "update carried %g seconds, expected %g",
+                update.delta.value,
+                expected
+            );
+            runs++;
+        }
+    }
+    CHECK(runs == updates, "%zu updates run, expected %zu", runs, updates);
+    CHECK(
+        governor.counters.skipped_updates == updates * (interval - 1),
+        "%zu skipped, expected %zu",
+        governor.counters.skipped_updates,
+        updates * (interval - 1)
+    );
+}
+
+int
+main(void)
+{
+    test_degrade_and_restore();
+    test_degrades_stop_at_the_cheapest_level();
+    test_pacer_skips_and_carries_time();
+
+    if (failures > 0)
+    {
+        printf("%zu failure(s)\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("frame governor: all checks passed\n");
+
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,222 @@
+/*
+ * Feeds synthetic window size sequences to the resize coalescer and checks
+ * which frames report a resize.
+ */
+#include "resize_coalescer.h"
+
+#include "utils.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static size_t failures;
+
+#define CHECK(condition, ...) \
+    do \
+    { \
+        if (!(condition)) \
+        { \
+            printf("%s:%d: ", __FILE__, __LINE__); \
+            printf(__VA_ARGS__); \
+            printf("\n"); \
+            failures++; \
+        } \
+    } while (0)
+
+/* Binary fractions, so the frame counts below are exact. */
+static DeltaTime const frame = {1.f / 64.f};
+static size_t const settle_frames = 8;
+static size_t const max_delay_frames = 32;
+
+static resize_coalescer_config_st const config = {
+    .settle_time = 8.f / 64.f,
+    .max_delay = 32.f / 64.f,
+};
+
+static ScreenSize const initial = {.width = 800.f, .height = 600.f};
+
+static bool
+same_size(ScreenSize const a, ScreenSize const b)
+{
+    return a.width == b.width && a.height == b.height;
+}
+
+static void
+test_no_change(void)
+{
+    resize_coalescer_st coalescer;
+
+    resize_coalescer_init(&coalescer, &config, initial);
+    for (size_t i = 0; i < 100; i++)
+    {
+        ResizeEvent const event = resize_coalescer_update(&coalescer, initial, frame);
+
+        CHECK(!event.resized, "resize reported at frame %zu without a change", i);
+        CHECK(same_size(event.size, initial), "size changed at frame %zu", i);
+    }
+}
+
+static void
+test_single_change_settles(void)
+{
+    resize_coalescer_st coalescer;
+    ScreenSize const larger = {.width = 1024.f, .height = 768.f};
+
+    resize_coalescer_init(&coalescer, &config, initial);
+
+    /* The change is seen on frame 0 and reported once it has held for the settle time. */
+    for (size_t i = 0; i <= settle_frames; i++)
+    {
+        ResizeEvent const event = resize_coalescer_update(&coalescer, larger, frame);
+
+        if (i < settle_frames)
+        {
+            CHECK(!event.resized, "reported at frame %zu, before settling", i);
+            CHECK(same_size(event.size, initial), "new size reported before settling");
+        }
+        else
+        {
+            CHECK(event.resized, "not reported once settled at frame %zu", i);
+            CHECK(same_size(event.size, larger), "settled size not reported");
+        }
+    }
+
+    ResizeEvent const after = resize_coalescer_update(&coalescer, larger, frame);
+
+    CHECK(!after.resized, "reported twice");
+    CHECK(same_size(after.size, larger), "size lost after reporting");
+}
+
+static void
+test_storm_settles_once(void)
+{
+    resize_coalescer_st coalescer;
+    size_t const storm_frames = 20;
+    size_t events = 0;
+    size_t event_frame = 0;
+    ScreenSize size = initial;
+    ScreenSize reported = initial;
+
+    resize_coalescer_init(&coalescer, &config, initial);
+
+    for (size_t i = 0; i < storm_frames + 50; i++)
+    {
+        if (i < storm_frames)
+        {
+            size.width = initial.width + 10.f * (i + 1);
+            size.height = initial.height + 5.f * (i % 3);
+        }
+
+        ResizeEvent const event = resize_coalescer_update(&coalescer, size, frame);
+
+        if (event.resized)
+        {
+            events++;
+            event_frame = i;
+            reported = event.size;
+        }
+    }
+
+    CHECK(events == 1, "%zu resize events for one storm", events);
+    CHECK(
+        event_frame == storm_frames - 1 + settle_frames,
+        "reported at frame %zu, expected %zu",
+        event_frame,
+        storm_frames - 1 + settle_frames
+    );
+    CHECK(same_size(reported, size), "reported %gx%g", reported.width, reported.height);
+}
+
+static void
+test_long_drag_reports_at_max_delay(void)
+{
+    resize_coalescer_st coalescer;
+    size_t const drag_frames = 4 * max_delay_frames;
+    size_t events = 0;
+    size_t last_event = 0;
+    ScreenSize size = initial;
+
+    resize_coalescer_init(&coalescer, &config, initial);
+
+    for (size_t i = 0; i < drag_frames; i++)
+    {
+        size.width += 1.f;
+
+        ResizeEvent const event = resize_coalescer_update(&coalescer, size, frame);
+
+        if (!event.resized)
+        {
+            continue;
+        }
+        events++;
+        CHECK(
+            (i + 1) % max_delay_frames == 0,
+            "drag reported at frame %zu, not after the max delay",
+            i
+        );
+        CHECK(same_size(event.size, size), "drag reported a stale size at frame %zu", i);
+        last_event = i;
+    }
+
+    CHECK(
+        events == drag_frames / max_delay_frames,
+        "%zu events during the drag, expected %zu",
+        events,
+        drag_frames / max_delay_frames
+    );
+    CHECK(last_event == drag_frames - 1, "last drag event at frame %zu", last_event);
+}
+
+static void
+test_return_to_original_size(void)
+{
+    resize_coalescer_st coalescer;
+    ScreenSize const path[] = {
+        {.width = 850.f, .height = 600.f},
+        {.width = 900.f, .height = 650.f},
+        {.width = 850.f, .height = 620.f},
+        initial,
+    };
+
+    resize_coalescer_init(&coalescer, &config, initial);
+
+    for (size_t i = 0; i < ARRAY_SIZE(path) + 50; i++)
+    {
+        ScreenSize const size = i < ARRAY_SIZE(path) ? path[i] : initial;
+        ResizeEvent const event = resize_coalescer_update(&coalescer, size, frame);
+
+        CHECK(!event.resized, "resize reported at frame %zu for a drag back to the start", i);
+        CHECK(same_size(event.size, initial), "size changed at frame %zu", i);
+    }
+
+    /* The drag was settled, so a later change is reported as normal. */
+    ScreenSize const larger = {.width = 1024.f, .height = 768.f};
+    bool reported = false;
+
+    for (size_t i = 0; i <= settle_frames; i++)
+    {
+        reported = resize_coalescer_update(&coalescer, larger, frame).resized || reported;
+    }
+    CHECK(reported, "change after a drag back to the start was not reported");
+}
+
+int
+main(void)
+{
+    test_no_change();
+    test_single_change_settles();
+    test_storm_settles_once();
+    test_long_drag_reports_at_max_delay();
+    test_return_to_original_size();
+
+    if (failures > 0)
+    {
+        printf("%zu failure(s)\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("resize coalescer: all checks passed\n");
+
+    return EXIT_SUCCESS;
+}
+
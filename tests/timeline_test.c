@@ -0,0 +1,310 @@
+/*
+ * Checks compiled timelines against hand-worked values at the edges of each
+ * track, including mirrored (yoyo) passes and times before anything starts.
+ */
+#include "timeline.h"
+
+#include "utils.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static size_t failures;
+
+#define CHECK(condition, ...) \
+    do \
+    { \
+        if (!(condition)) \
+        { \
+            printf("%s:%d: ", __FILE__, __LINE__); \
+            printf(__VA_ARGS__); \
+            printf("\n"); \
+            failures++; \
+        } \
+    } while (0)
+
+enum
+{
+    PROPERTY_A,
+    PROPERTY_B,
+    PROPERTY_C,
+    PROPERTY_COUNT,
+};
+
+/* Written into every value before evaluating, to show properties left untouched. */
+static float const untouched = -100.f;
+
+typedef struct
+{
+    float time;
+    size_t property;
+    float expected;
+} expected_value_st;
+
+static void
+check_values(
+    char const * const name,
+    timeline_st const * const timeline,
+    expected_value_st const * const expected,
+    size_t const count
+)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        float values[PROPERTY_COUNT] = {untouched, untouched, untouched};
+
+        timeline_evaluate(timeline, expected[i].time, values);
+
+        float const actual = values[expected[i].property];
+
+        CHECK(
+            fabsf(actual - expected[i].expected) < 1e-4f,
+            "%s: property %zu at %g is %g, expected %g",
+            name,
+            expected[i].property,
+            expected[i].time,
+            actual,
+            expected[i].expected
+        );
+    }
+}
+
+static float
+ease_square(float const fraction)
+{
+    return fraction * fraction;
+}
+
+static void
+test_single_tween(void)
+{
+    timeline_builder_st * const builder = timeline_builder_new();
+    timeline_node_st const root = timeline_tween(builder, PROPERTY_A, 2.f, 6.f, 2.f, NULL);
+    timeline_st * const timeline = timeline_compile(builder, root);
+    expected_value_st const expected[] = {
+        /* The first track supplies the value before it starts. */
+        {-1.f, PROPERTY_A, 2.f},
+        {0.f, PROPERTY_A, 2.f},
+        {1.f, PROPERTY_A, 4.f},
+        {2.f, PROPERTY_A, 6.f},
+        {5.f, PROPERTY_A, 6.f},
+        {1.f, PROPERTY_B, untouched},
+    };
+
+    CHECK(timeline_duration(timeline) == 2.f, "duration %g", timeline_duration(timeline));
+    check_values("single tween", timeline, expected, ARRAY_SIZE(expected));
+
+    timeline_free(timeline);
+    timeline_builder_free(builder);
+}
+
+static void
+test_sequence(void)
+{
+    timeline_builder_st * const builder = timeline_builder_new();
+    timeline_node_st const steps[] = {
+        timeline_delay(builder, 1.f),
+        timeline_tween(builder, PROPERTY_A, 0.f, 10.f, 1.f, NULL),
+        timeline_tween(builder, PROPERTY_A, 10.f, 20.f, 2.f, NULL),
+        /* A zero length tween jumps to its end value once reached. */
+        timeline_tween(builder, PROPERTY_B, 0.f, 1.f, 0.f, NULL),
+    };
+    timeline_st * const timeline =
+        timeline_compile(builder, timeline_sequence(builder, steps, ARRAY_SIZE(steps)));
+    expected_value_st const expected[] = {
+        {0.5f, PROPERTY_A, 0.f},
+        {1.f, PROPERTY_A, 0.f},
+        {1.5f, PROPERTY_A, 5.f},
+        /* The second tween has started, so it decides. */
+        {2.f, PROPERTY_A, 10.f},
+        {3.f, PROPERTY_A, 15.f},
+        {4.f, PROPERTY_A, 20.f},
+        {10.f, PROPERTY_A, 20.f},
+        {3.9f, PROPERTY_B, 0.f},
+        {4.f, PROPERTY_B, 1.f},
+    };
+
+    CHECK(timeline_duration(timeline) == 4.f, "duration %g", timeline_duration(timeline));
+    check_values("sequence", timeline, expected, ARRAY_SIZE(expected));
+
+    timeline_free(timeline);
+    timeline_builder_free(builder);
+}
+
+static void
+test_parallel_and_stagger(void)
+{
+    timeline_builder_st * const builder = timeline_builder_new();
+    timeline_node_st const parallel_children[] = {
+        timeline_tween(builder, PROPERTY_A, 0.f, 1.f, 1.f, NULL),
+        /* Same property and start: the later child decides. */
+        timeline_tween(builder, PROPERTY_A, 5.f, 6.f, 1.f, NULL),
+        timeline_tween(builder, PROPERTY_B, 0.f, 3.f, 3.f, NULL),
+    };
+    timeline_st * const parallel = timeline_compile(
+        builder, timeline_parallel(builder, parallel_children, ARRAY_SIZE(parallel_children))
+    );
+    expected_value_st const parallel_expected[] = {
+        {0.5f, PROPERTY_A, 5.5f},
+        {0.5f, PROPERTY_B, 0.5f},
+        {3.f, PROPERTY_B, 3.f},
+    };
+
+    CHECK(timeline_duration(parallel) == 3.f, "duration %g", timeline_duration(parallel));
+    check_values("parallel", parallel, parallel_expected, ARRAY_SIZE(parallel_expected));
+
+    timeline_node_st const stagger_children[] = {
+        timeline_tween(builder, PROPERTY_A, 0.f, 1.f, 1.f, NULL),
+        timeline_tween(builder, PROPERTY_B, 0.f, 1.f, 1.f, NULL),
+        timeline_tween(builder, PROPERTY_C, 0.f, 1.f, 1.f, NULL),
+    };
+    timeline_st * const stagger = timeline_compile(
+        builder, timeline_stagger(builder, stagger_children, ARRAY_SIZE(stagger_children), 0.5f)
+    );
+    expected_value_st const stagger_expected[] = {
+        {1.f, PROPERTY_A, 1.f},
+        {1.f, PROPERTY_B, 0.5f},
+        {1.f, PROPERTY_C, 0.f},
+        {2.f, PROPERTY_C, 1.f},
+    };
+
+    CHECK(timeline_duration(stagger) == 2.f, "duration %g", timeline_duration(stagger));
+    check_values("stagger", stagger, stagger_expected, ARRAY_SIZE(stagger_expected));
+
+    timeline_free(parallel);
+    timeline_free(stagger);
+    timeline_builder_free(builder);
+}
+
+static void
+test_repeat(void)
+{
+    timeline_builder_st * const builder = timeline_builder_new();
+    timeline_node_st const tween = timeline_tween(builder, PROPERTY_A, 0.f, 10.f, 1.f, NULL);
+    timeline_st * const repeat =
+        timeline_compile(builder, timeline_repeat(builder, tween, 3, false));
+    timeline_st * const yoyo =
+        timeline_compile(builder, timeline_repeat(builder, tween, 3, true));
+    expected_value_st const repeat_expected[] = {
+        {0.25f, PROPERTY_A, 2.5f},
+        {1.f, PROPERTY_A, 0.f},
+        {1.25f, PROPERTY_A, 2.5f},
+        {3.f, PROPERTY_A, 10.f},
+    };
+    expected_value_st const yoyo_expected[] = {
+        {-1.f, PROPERTY_A, 0.f},
+        {0.25f, PROPERTY_A, 2.5f},
+        /* The second pass runs backwards from where the first ended. */
+        {1.f, PROPERTY_A, 10.f},
+        {1.25f, PROPERTY_A, 7.5f},
+        {2.f, PROPERTY_A, 0.f},
+        {2.5f, PROPERTY_A, 5.f},
+        {3.f, PROPERTY_A, 10.f},
+    };
+
+    CHECK(timeline_duration(repeat) == 3.f, "duration %g", timeline_duration(repeat));
+    check_values("repeat", repeat, repeat_expected, ARRAY_SIZE(repeat_expected));
+    check_values("yoyo", yoyo, yoyo_expected, ARRAY_SIZE(yoyo_expected));
+
+    timeline_free(repeat);
+    timeline_free(yoyo);
+    timeline_builder_free(builder);
+}
+
+static void
+test_mirrored_children(void)
+{
+    timeline_builder_st * const builder = timeline_builder_new();
+    timeline_node_st const steps[] = {
+        timeline_tween(builder, PROPERTY_A, 0.f, 10.f, 1.f, NULL),
+        timeline_tween(builder, PROPERTY_B, 0.f, 10.f, 1.f, NULL),
+    };
+    timeline_node_st const sequence = timeline_sequence(builder, steps, ARRAY_SIZE(steps));
+    timeline_st * const sequence_yoyo =
+        timeline_compile(builder, timeline_repeat(builder, sequence, 2, true));
+    /*
+     * On the backwards pass over [2, 4] the children are mirrored: B runs
+     * backwards over [2, 3], then A over [3, 4].
+     */
+    expected_value_st const sequence_expected[] = {
+        {1.5f, PROPERTY_A, 10.f},
+        {1.5f, PROPERTY_B, 5.f},
+        {2.5f, PROPERTY_A, 10.f},
+        {2.5f, PROPERTY_B, 5.f},
+        {3.f, PROPERTY_B, 0.f},
+        {3.5f, PROPERTY_A, 5.f},
+        {3.5f, PROPERTY_B, 0.f},
+        {4.f, PROPERTY_A, 0.f},
+    };
+
+    check_values(
+        "mirrored sequence", sequence_yoyo, sequence_expected, ARRAY_SIZE(sequence_expected)
+    );
+
+    timeline_node_st const stagger = timeline_stagger(builder, steps, ARRAY_SIZE(steps), 0.5f);
+    timeline_st * const stagger_yoyo =
+        timeline_compile(builder, timeline_repeat(builder, stagger, 2, true));
+    /*
+     * The stagger lasts 1.5s. Backwards over [1.5, 3], B starts first at 1.5
+     * and A half a second later, at 2.
+     */
+    expected_value_st const stagger_expected[] = {
+        {1.5f, PROPERTY_A, 10.f},
+        {1.5f, PROPERTY_B, 10.f},
+        {2.f, PROPERTY_A, 10.f},
+        {2.f, PROPERTY_B, 5.f},
+        {2.5f, PROPERTY_A, 5.f},
+        {2.5f, PROPERTY_B, 0.f},
+        {3.f, PROPERTY_A, 0.f},
+    };
+
+    check_values(
+        "mirrored stagger", stagger_yoyo, stagger_expected, ARRAY_SIZE(stagger_expected)
+    );
+
+    timeline_free(sequence_yoyo);
+    timeline_free(stagger_yoyo);
+    timeline_builder_free(builder);
+}
+
+static void
+test_easing(void)
+{
+    timeline_builder_st * const builder = timeline_builder_new();
+    timeline_node_st const tween = timeline_tween(builder, PROPERTY_A, 0.f, 1.f, 1.f, ease_square);
+    timeline_st * const timeline =
+        timeline_compile(builder, timeline_repeat(builder, tween, 2, true));
+    /* A backwards pass eases the mirrored fraction. */
+    expected_value_st const expected[] = {
+        {0.5f, PROPERTY_A, 0.25f},
+        {1.25f, PROPERTY_A, 0.5625f},
+        {2.f, PROPERTY_A, 0.f},
+    };
+
+    check_values("easing", timeline, expected, ARRAY_SIZE(expected));
+
+    timeline_free(timeline);
+    timeline_builder_free(builder);
+}
+
+int
+main(void)
+{
+    test_single_tween();
+    test_sequence();
+    test_parallel_and_stagger();
+    test_repeat();
+    test_mirrored_children();
+    test_easing();
+
+    if (failures > 0)
+    {
+        printf("%zu failure(s)\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("timeline: all checks passed\n");
+
+    return EXIT_SUCCESS;
+}
+